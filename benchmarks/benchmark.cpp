@@ -0,0 +1,146 @@
+/*******************************************************************\
+
+Module: Microbenchmarks
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Driver that runs the microbenchmarks and reports their times
+
+#include "benchmark.h"
+
+#include <util/json.h>
+#include <util/string2int.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+
+void benchmark_runt::measure(const std::function<void()> &body)
+{
+  body();
+
+  for(std::size_t i = 0; i < repetitions; ++i)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    body();
+    times.push_back(std::chrono::steady_clock::now() - start);
+  }
+}
+
+static void help()
+{
+  std::cout
+    << "Usage: cprover-benchmarks [options] [filter ...]\n"
+       "Runs the benchmarks whose name contains one of the filters, or all\n"
+       "benchmarks if no filter is given.\n"
+       "\n"
+       " --list                 list the benchmarks and exit\n"
+       " --repetitions n        measure each benchmark n times (default 5)\n"
+       " --json                 report the results in JSON format\n";
+}
+
+int main(int argc, const char **argv)
+{
+  benchmarkst benchmarks;
+  irep_benchmarks(benchmarks);
+  irep_serialization_benchmarks(benchmarks);
+  sharing_map_benchmarks(benchmarks);
+  simplify_expr_benchmarks(benchmarks);
+  string_container_benchmarks(benchmarks);
+  bv_utils_benchmarks(benchmarks);
+
+  std::size_t repetitions = 5;
+  bool json = false;
+  std::vector<std::string> filters;
+
+  for(int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+    if(arg == "--list")
+    {
+      for(const auto &benchmark : benchmarks)
+        std::cout << benchmark.first << '\n';
+      return 0;
+    }
+    else if(arg == "--json")
+      json = true;
+    else if(arg == "--repetitions" && i + 1 < argc)
+    {
+      const auto value = string2optional_size_t(argv[++i]);
+      if(!value.has_value() || *value == 0)
+      {
+        std::cerr << "invalid number of repetitions\n";
+        return 1;
+      }
+      repetitions = *value;
+    }
+    else if(arg == "-h" || arg == "--help")
+    {
+      help();
+      return 0;
+    }
+    else if(!arg.empty() && arg[0] == '-')
+    {
+      help();
+      return 1;
+    }
+    else
+      filters.push_back(arg);
+  }
+
+  json_arrayt json_results;
+
+  for(const auto &benchmark : benchmarks)
+  {
+    const std::string &name = benchmark.first;
+    if(
+      !filters.empty() &&
+      std::none_of(
+        filters.begin(), filters.end(), [&name](const std::string &filter) {
+          return name.find(filter) != std::string::npos;
+        }))
+    {
+      continue;
+    }
+
+    benchmark_runt run(repetitions);
+    benchmark.second(run);
+
+    std::sort(run.times.begin(), run.times.end());
+    const double min = run.times.empty() ? 0 : run.times.front().count();
+    const double median =
+      run.times.empty() ? 0 : run.times[run.times.size() / 2].count();
+
+    if(json)
+    {
+      json_objectt json_counters;
+      for(const auto &counter : run.counters)
+        json_counters[counter.first] =
+          json_numbert(std::to_string(counter.second));
+
+      json_results.push_back(json_objectt{
+        {"name", json_stringt(name)},
+        {"repetitions", json_numbert(std::to_string(run.times.size()))},
+        {"min", json_numbert(std::to_string(min))},
+        {"median", json_numbert(std::to_string(median))},
+        {"counters", std::move(json_counters)}});
+    }
+    else
+    {
+      std::cout << std::left << std::setw(40) << name << std::right
+                << std::fixed << std::setprecision(6) << " min " << min
+                << "s  median " << median << 's';
+      for(const auto &counter : run.counters)
+        std::cout << "  " << counter.first << ' ' << counter.second;
+      std::cout << std::endl;
+    }
+  }
+
+  if(json)
+    std::cout << json_results << '\n';
+
+  return 0;
+}
@@ -0,0 +1,63 @@
+/*******************************************************************\
+
+Module: Microbenchmarks
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Microbenchmarks
+
+#ifndef CPROVER_BENCHMARKS_BENCHMARK_H
+#define CPROVER_BENCHMARKS_BENCHMARK_H
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+/// Seed of the random number generators used to build workloads, so that all
+/// runs measure the same work
+const unsigned benchmark_seed = 0;
+
+/// Measurements of one benchmark
+class benchmark_runt
+{
+public:
+  explicit benchmark_runt(std::size_t repetitions) : repetitions(repetitions)
+  {
+  }
+
+  /// Time \p body once to warm up caches and allocators, and then once per
+  /// repetition. Any setup the body depends on should be done before calling
+  /// this, as only the body is timed.
+  void measure(const std::function<void()> &body);
+
+  /// Report \p value, which should be the same on every run, alongside the
+  /// times, for example the size of a data structure or an encoding
+  void counter(const std::string &name, std::size_t value)
+  {
+    counters[name] = value;
+  }
+
+  const std::size_t repetitions;
+  std::vector<std::chrono::duration<double>> times;
+  std::map<std::string, std::size_t> counters;
+};
+
+typedef std::function<void(benchmark_runt &)> benchmark_functiont;
+
+/// Benchmarks by name, which are of the form `<module>/<operation>`
+typedef std::map<std::string, benchmark_functiont> benchmarkst;
+
+void irep_benchmarks(benchmarkst &);
+void irep_serialization_benchmarks(benchmarkst &);
+void sharing_map_benchmarks(benchmarkst &);
+void simplify_expr_benchmarks(benchmarkst &);
+void string_container_benchmarks(benchmarkst &);
+void bv_utils_benchmarks(benchmarkst &);
+
+#endif // CPROVER_BENCHMARKS_BENCHMARK_H
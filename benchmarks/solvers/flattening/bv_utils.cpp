@@ -0,0 +1,100 @@
+/*******************************************************************\
+
+Module: Microbenchmarks for bv_utilst
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <benchmark.h>
+
+#include <util/message.h>
+
+#include <solvers/flattening/bv_utils.h>
+#include <solvers/sat/dimacs_cnf.h>
+#include <solvers/sat/satcheck.h>
+
+typedef std::function<bvt(bv_utilst &, const bvt &, const bvt &)> encodert;
+
+/// Time encoding many instances of an operator on fresh variables, and report
+/// the size of one instance
+static void
+encode(benchmark_runt &run, std::size_t width, const encodert &encoder)
+{
+  null_message_handlert message_handler;
+  std::size_t variables = 0;
+  std::size_t clauses = 0;
+
+  run.measure([&] {
+    for(std::size_t i = 0; i < 100; ++i)
+    {
+      dimacs_cnft cnf(message_handler);
+      bv_utilst bv_utils(cnf);
+      const bvt op0 = cnf.new_variables(width);
+      const bvt op1 = cnf.new_variables(width);
+      const std::size_t variables_before = cnf.no_variables();
+      encoder(bv_utils, op0, op1);
+      variables = cnf.no_variables() - variables_before;
+      clauses = cnf.no_clauses();
+    }
+  });
+
+  run.counter("variables", variables);
+  run.counter("clauses", clauses);
+}
+
+static void adder(benchmark_runt &run)
+{
+  encode(run, 64, [](bv_utilst &bv_utils, const bvt &op0, const bvt &op1) {
+    return bv_utils.add(op0, op1);
+  });
+}
+
+static void multiplier(benchmark_runt &run)
+{
+  encode(run, 32, [](bv_utilst &bv_utils, const bvt &op0, const bvt &op1) {
+    return bv_utils.unsigned_multiplier(op0, op1);
+  });
+}
+
+static void multiplier_solve(benchmark_runt &run)
+{
+  // factor the product of two 12-bit primes
+  const std::size_t width = 24;
+  const mp_integer product = 4093 * 4091;
+
+  null_message_handlert message_handler;
+  std::size_t variables = 0;
+  std::size_t clauses = 0;
+
+  run.measure([&] {
+    satcheckt satcheck(message_handler);
+    bv_utilst bv_utils(satcheck);
+
+    const bvt op0 = bv_utils.zero_extension(satcheck.new_variables(12), width);
+    const bvt op1 = bv_utils.zero_extension(satcheck.new_variables(12), width);
+    const bvt one = bv_utils.build_constant(1, width);
+
+    satcheck.l_set_to_true(bv_utils.equal(
+      bv_utils.unsigned_multiplier(op0, op1),
+      bv_utils.build_constant(product, width)));
+    satcheck.l_set_to_true(
+      bv_utils.rel(op0, ID_gt, one, bv_utilst::representationt::UNSIGNED));
+    satcheck.l_set_to_true(
+      bv_utils.rel(op1, ID_gt, one, bv_utilst::representationt::UNSIGNED));
+
+    satcheck.prop_solve();
+    variables = satcheck.no_variables();
+    clauses = satcheck.no_clauses();
+  });
+
+  run.counter("variables", variables);
+  run.counter("clauses", clauses);
+}
+
+void bv_utils_benchmarks(benchmarkst &benchmarks)
+{
+  benchmarks["bv_utils/adder-encoding"] = adder;
+  benchmarks["bv_utils/multiplier-encoding"] = multiplier;
+  benchmarks["bv_utils/multiplier-solve"] = multiplier_solve;
+}
@@ -0,0 +1,150 @@
+/*******************************************************************\
+
+Module: Microbenchmarks for irept
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <benchmark.h>
+
+#include <util/irep.h>
+
+#include <random>
+
+/// \return a tree with two to four operands per node and \p depth levels,
+///   shaped like an expression
+static irept make_tree(std::mt19937 &generator, std::size_t depth)
+{
+  if(depth == 0)
+  {
+    irept leaf(ID_symbol);
+    leaf.set(ID_identifier, generator() % 100);
+    leaf.add(ID_type).id(ID_signedbv);
+    return leaf;
+  }
+
+  irept node(generator() % 2 == 0 ? ID_plus : ID_mult);
+  node.add(ID_type).id(ID_signedbv);
+  const std::size_t operands = 2 + generator() % 3;
+  for(std::size_t i = 0; i < operands; ++i)
+    node.get_sub().push_back(make_tree(generator, depth - 1));
+  return node;
+}
+
+static std::vector<irept> make_trees(std::size_t count, std::size_t depth)
+{
+  std::mt19937 generator(benchmark_seed);
+  std::vector<irept> trees;
+  trees.reserve(count);
+  for(std::size_t i = 0; i < count; ++i)
+    trees.push_back(make_tree(generator, depth));
+  return trees;
+}
+
+static std::size_t count_nodes(const irept &irep)
+{
+  std::size_t nodes = 1;
+  for(const auto &sub : irep.get_sub())
+    nodes += count_nodes(sub);
+  for(const auto &named_sub : irep.get_named_sub())
+    nodes += count_nodes(named_sub.second);
+  return nodes;
+}
+
+static void construct(benchmark_runt &run)
+{
+  std::size_t nodes = 0;
+  run.measure([&nodes] {
+    nodes = 0;
+    for(const auto &tree : make_trees(1000, 5))
+      nodes += count_nodes(tree);
+  });
+  run.counter("nodes", nodes);
+}
+
+static void copy_on_write(benchmark_runt &run)
+{
+  const std::vector<irept> trees = make_trees(1000, 5);
+  run.measure([&trees] {
+    // copies share the tree; changing a leaf copies the path to it
+    std::vector<irept> copies(trees);
+    for(auto &copy : copies)
+    {
+      irept *node = &copy;
+      while(!node->get_sub().empty())
+        node = &node->get_sub().back();
+      node->set(ID_identifier, "changed");
+    }
+  });
+}
+
+static void full_hash(benchmark_runt &run)
+{
+  // unlike hash(), full_hash() is not cached in the tree
+  const std::vector<irept> trees = make_trees(1000, 5);
+  run.measure([&trees] {
+    for(const auto &tree : trees)
+      tree.full_hash();
+  });
+}
+
+static void compare(benchmark_runt &run)
+{
+  // build the same trees twice so that they are equal but not shared
+  const std::vector<irept> left = make_trees(1000, 5);
+  const std::vector<irept> right = make_trees(1000, 5);
+  std::size_t equal = 0;
+  run.measure([&left, &right, &equal] {
+    equal = 0;
+    for(std::size_t i = 0; i < left.size(); ++i)
+    {
+      equal += left[i] == right[i];
+      equal += left[i].compare(right[(i + 1) % right.size()]) == 0;
+    }
+  });
+  run.counter("equal", equal);
+}
+
+static void allocate(benchmark_runt &run)
+{
+  // build and destroy many short-lived trees, as the simplifier does; compare
+  // builds with and without IREP_POOL or ATOMIC_REF_COUNT
+  std::size_t nodes = 0;
+  run.measure([&nodes] {
+    nodes = 0;
+    for(std::size_t round = 0; round < 200; ++round)
+    {
+      std::vector<irept> trees;
+      for(std::size_t i = 0; i < 1000; ++i)
+      {
+        irept tree(ID_plus);
+        for(std::size_t j = 0; j < 10; ++j)
+        {
+          irept leaf(ID_symbol);
+          leaf.set(ID_identifier, j);
+          leaf.add(ID_type).id(ID_signedbv);
+          tree.get_sub().push_back(leaf);
+          nodes += 2;
+        }
+        trees.push_back(tree);
+        // detaching copies a node
+        trees.back().set(ID_value, i);
+        nodes += 1;
+      }
+    }
+  });
+  run.counter("nodes", nodes);
+  run.counter("node-bytes", sizeof(irept::dt));
+  run.counter("pool", IREP_POOL);
+  run.counter("atomic", ATOMIC_REF_COUNT);
+}
+
+void irep_benchmarks(benchmarkst &benchmarks)
+{
+  benchmarks["irep/construct"] = construct;
+  benchmarks["irep/copy-on-write"] = copy_on_write;
+  benchmarks["irep/full-hash"] = full_hash;
+  benchmarks["irep/compare"] = compare;
+  benchmarks["irep/allocate"] = allocate;
+}
@@ -0,0 +1,82 @@
+/*******************************************************************\
+
+Module: Microbenchmarks for irep_serializationt
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <benchmark.h>
+
+#include <util/irep_serialization.h>
+
+#include <random>
+#include <sstream>
+
+/// \return a tree with many shared subtrees and repeated identifiers, as in a
+///   goto binary
+static irept make_tree(std::mt19937 &generator, std::size_t depth)
+{
+  if(depth == 0)
+  {
+    irept leaf(ID_symbol);
+    leaf.set(ID_identifier, "main::1::x" + std::to_string(generator() % 1000));
+    leaf.add(ID_type).id(ID_signedbv);
+    leaf.add(ID_type).set(ID_width, 32);
+    return leaf;
+  }
+
+  irept node(generator() % 2 == 0 ? ID_plus : ID_mult);
+  node.add(ID_type).id(ID_signedbv);
+  node.add(ID_type).set(ID_width, 32);
+  node.get_sub().push_back(make_tree(generator, depth - 1));
+  node.get_sub().push_back(make_tree(generator, depth - 1));
+  return node;
+}
+
+static std::vector<irept> make_trees()
+{
+  std::mt19937 generator(benchmark_seed);
+  std::vector<irept> trees;
+  for(std::size_t i = 0; i < 2000; ++i)
+    trees.push_back(make_tree(generator, 6));
+  return trees;
+}
+
+static std::string write_trees(const std::vector<irept> &trees)
+{
+  std::ostringstream out;
+  irep_serializationt::ireps_containert ireps_container;
+  irep_serializationt serialization(ireps_container);
+  for(const auto &tree : trees)
+    serialization.reference_convert(tree, out);
+  return out.str();
+}
+
+static void write(benchmark_runt &run)
+{
+  const std::vector<irept> trees = make_trees();
+  std::size_t bytes = 0;
+  run.measure([&trees, &bytes] { bytes = write_trees(trees).size(); });
+  run.counter("bytes", bytes);
+}
+
+static void read(benchmark_runt &run)
+{
+  const std::vector<irept> trees = make_trees();
+  const std::string data = write_trees(trees);
+  run.measure([&trees, &data] {
+    std::istringstream in(data);
+    irep_serializationt::ireps_containert ireps_container;
+    irep_serializationt serialization(ireps_container);
+    for(std::size_t i = 0; i < trees.size(); ++i)
+      serialization.reference_convert(in);
+  });
+  run.counter("bytes", data.size());
+}
+
+void irep_serialization_benchmarks(benchmarkst &benchmarks)
+{
+  benchmarks["irep_serialization/write"] = write;
+  benchmarks["irep_serialization/read"] = read;
+}
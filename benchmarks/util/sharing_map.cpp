@@ -0,0 +1,141 @@
+/*******************************************************************\
+
+Module: Microbenchmarks for sharing_mapt
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <benchmark.h>
+
+#include <util/irep.h>
+#include <util/sharing_map.h>
+
+#include <random>
+
+// keyed like the symex state, by the names of variables
+typedef sharing_mapt<irep_idt, std::size_t, false, irep_id_hash> mapt;
+
+static std::vector<irep_idt> make_keys(std::size_t count)
+{
+  std::vector<irep_idt> keys;
+  keys.reserve(count);
+  for(std::size_t i = 0; i < count; ++i)
+    keys.push_back("main::1::x" + std::to_string(i) + "!0@1");
+  return keys;
+}
+
+static void insert(benchmark_runt &run)
+{
+  const std::vector<irep_idt> keys = make_keys(100000);
+  std::size_t size = 0;
+  run.measure([&keys, &size] {
+    mapt map;
+    for(std::size_t i = 0; i < keys.size(); ++i)
+      map.insert(keys[i], i);
+    size = map.size();
+  });
+  run.counter("size", size);
+}
+
+static void find(benchmark_runt &run)
+{
+  const std::vector<irep_idt> keys = make_keys(100000);
+  mapt map;
+  for(std::size_t i = 0; i < keys.size(); i += 2)
+    map.insert(keys[i], i);
+
+  std::size_t found = 0;
+  run.measure([&keys, &map, &found] {
+    // half of the lookups miss
+    found = 0;
+    for(const auto &key : keys)
+      found += map.find(key).has_value();
+  });
+  run.counter("found", found);
+}
+
+static void delta_view(benchmark_runt &run)
+{
+  // as at a merge in symex: two copies of a large state that differ in a few
+  // entries each
+  const std::vector<irep_idt> keys = make_keys(100000);
+  mapt base;
+  for(std::size_t i = 0; i < keys.size(); ++i)
+    base.insert(keys[i], i);
+
+  std::mt19937 generator(benchmark_seed);
+  std::vector<std::pair<mapt, mapt>> branches(100, {base, base});
+  for(auto &branch : branches)
+  {
+    for(std::size_t i = 0; i < 10; ++i)
+    {
+      branch.first.replace(keys[generator() % keys.size()], 0);
+      branch.second.replace(keys[generator() % keys.size()], 1);
+    }
+  }
+
+  std::size_t items = 0;
+  run.measure([&branches, &items] {
+    items = 0;
+    for(const auto &branch : branches)
+    {
+      mapt::delta_viewt delta_view;
+      branch.first.get_delta_view(branch.second, delta_view, false);
+      items += delta_view.size();
+    }
+  });
+  run.counter("items", items);
+}
+
+static void branch_and_merge(benchmark_runt &run)
+{
+  // as in symex: states are copied at branches, a few entries are updated on
+  // each path, and states are compared and merged at join points
+  const std::vector<irep_idt> keys = make_keys(100000);
+  mapt base;
+  for(std::size_t i = 0; i < keys.size(); ++i)
+    base.insert(keys[i], i);
+
+  std::size_t items = 0;
+  std::size_t equal = 0;
+  run.measure([&keys, &base, &items, &equal] {
+    std::mt19937 generator(benchmark_seed);
+    items = 0;
+    equal = 0;
+    for(std::size_t round = 0; round < 200; ++round)
+    {
+      mapt left(base);
+      mapt right(base);
+      for(std::size_t i = 0; i < 10; ++i)
+      {
+        left.replace(keys[generator() % keys.size()], 0);
+        right.replace(keys[generator() % keys.size()], 1);
+      }
+
+      mapt::delta_viewt delta_view;
+      left.get_delta_view(right, delta_view, false);
+      items += delta_view.size();
+
+      equal += left == right;
+      equal += left == base;
+
+      for(std::size_t i = 0; i < 10; ++i)
+      {
+        const irep_idt &key = keys[generator() % keys.size()];
+        left.erase(key);
+        left.insert(key, 2);
+      }
+    }
+  });
+  run.counter("items", items);
+  run.counter("equal", equal);
+}
+
+void sharing_map_benchmarks(benchmarkst &benchmarks)
+{
+  benchmarks["sharing_map/insert"] = insert;
+  benchmarks["sharing_map/find"] = find;
+  benchmarks["sharing_map/delta-view"] = delta_view;
+  benchmarks["sharing_map/branch-and-merge"] = branch_and_merge;
+}
@@ -0,0 +1,85 @@
+/*******************************************************************\
+
+Module: Microbenchmarks for simplify_exprt
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <benchmark.h>
+
+#include <util/arith_tools.h>
+#include <util/namespace.h>
+#include <util/simplify_expr.h>
+#include <util/std_expr.h>
+#include <util/symbol_table.h>
+
+#include <random>
+
+/// \return an integer expression over a few symbols and constants, with the
+///   mix of arithmetic, casts and conditionals that symex produces
+static exprt
+make_expr(std::mt19937 &generator, const typet &type, std::size_t depth)
+{
+  if(depth == 0)
+  {
+    if(generator() % 2 == 0)
+      return from_integer(generator() % 8, type);
+    return symbol_exprt("x" + std::to_string(generator() % 4), type);
+  }
+
+  exprt op0 = make_expr(generator, type, depth - 1);
+  exprt op1 = make_expr(generator, type, depth - 1);
+
+  switch(generator() % 6)
+  {
+  case 0:
+    return plus_exprt(std::move(op0), std::move(op1));
+  case 1:
+    return minus_exprt(std::move(op0), std::move(op1));
+  case 2:
+    return mult_exprt(std::move(op0), std::move(op1));
+  case 3:
+    return bitand_exprt(std::move(op0), std::move(op1));
+  case 4:
+  {
+    const signedbv_typet wide(64);
+    return typecast_exprt(
+      plus_exprt(
+        typecast_exprt(std::move(op0), wide),
+        typecast_exprt(std::move(op1), wide)),
+      type);
+  }
+  default:
+    return if_exprt(
+      equal_exprt(op0, from_integer(0, type)), std::move(op1), op0);
+  }
+}
+
+static void simplify_corpus(benchmark_runt &run)
+{
+  std::mt19937 generator(benchmark_seed);
+  const signedbv_typet type(32);
+  std::vector<exprt> corpus;
+  for(std::size_t i = 0; i < 2000; ++i)
+    corpus.push_back(make_expr(generator, type, 6));
+
+  symbol_tablet symbol_table;
+  const namespacet ns(symbol_table);
+
+  std::size_t changed = 0;
+  run.measure([&corpus, &ns, &changed] {
+    changed = 0;
+    for(const auto &expr : corpus)
+    {
+      exprt copy = expr;
+      changed += !simplify(copy, ns);
+    }
+  });
+  run.counter("changed", changed);
+}
+
+void simplify_expr_benchmarks(benchmarkst &benchmarks)
+{
+  benchmarks["simplify_expr/corpus"] = simplify_corpus;
+}
@@ -0,0 +1,54 @@
+/*******************************************************************\
+
+Module: Microbenchmarks for string_containert
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <benchmark.h>
+
+#include <util/string_container.h>
+
+static std::vector<std::string> make_strings(const std::string &prefix)
+{
+  std::vector<std::string> strings;
+  for(std::size_t i = 0; i < 100000; ++i)
+    strings.push_back(prefix + "::" + std::to_string(i) + "!0@1#2");
+  return strings;
+}
+
+static void intern_new(benchmark_runt &run)
+{
+  // the container never forgets a string, so each repetition, and the warm-up
+  // run, needs new ones
+  std::vector<std::vector<std::string>> rounds;
+  for(std::size_t i = 0; i <= run.repetitions; ++i)
+    rounds.push_back(make_strings("new" + std::to_string(i)));
+
+  std::size_t round = 0;
+  run.measure([&rounds, &round] {
+    for(const auto &s : rounds[round])
+      get_string_container()[s];
+    ++round;
+  });
+}
+
+static void intern_existing(benchmark_runt &run)
+{
+  const std::vector<std::string> strings = make_strings("existing");
+  for(const auto &s : strings)
+    get_string_container()[s];
+
+  run.measure([&strings] {
+    for(const auto &s : strings)
+      get_string_container()[s];
+  });
+  run.counter("strings", strings.size());
+}
+
+void string_container_benchmarks(benchmarkst &benchmarks)
+{
+  benchmarks["string_container/intern-new"] = intern_new;
+  benchmarks["string_container/intern-existing"] = intern_existing;
+}
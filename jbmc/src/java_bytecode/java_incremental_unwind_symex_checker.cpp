@@ -0,0 +1,41 @@
+/*******************************************************************\
+
+Module: Goto Checker using Incremental Unwinding of all Loops for Java
+
+Author: Daniel Kroening, Peter Schrammel
+
+ \*******************************************************************/
+
+/// \file
+/// Goto Checker using Incremental Unwinding of all Loops for Java
+
+#include "java_incremental_unwind_symex_checker.h"
+#include "java_trace_validation.h"
+
+goto_tracet java_incremental_unwind_symex_checkert::build_full_trace() const
+{
+  goto_tracet goto_trace =
+    incremental_unwind_symex_checkert::build_full_trace();
+  check_trace_assumptions(
+    goto_trace, ns, log, options.get_bool_option("validate-trace"));
+  return goto_trace;
+}
+
+goto_tracet java_incremental_unwind_symex_checkert::build_trace(
+  const irep_idt &property_id) const
+{
+  goto_tracet goto_trace =
+    incremental_unwind_symex_checkert::build_trace(property_id);
+  check_trace_assumptions(
+    goto_trace, ns, log, options.get_bool_option("validate-trace"));
+  return goto_trace;
+}
+
+goto_tracet java_incremental_unwind_symex_checkert::build_shortest_trace() const
+{
+  goto_tracet goto_trace =
+    incremental_unwind_symex_checkert::build_shortest_trace();
+  check_trace_assumptions(
+    goto_trace, ns, log, options.get_bool_option("validate-trace"));
+  return goto_trace;
+}
@@ -63,6 +63,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <java_bytecode/convert_java_nondet.h>
 #include <java_bytecode/java_bytecode_language.h>
 #include <java_bytecode/java_enum_static_init_unwind_handler.h>
+#include <java_bytecode/java_incremental_unwind_symex_checker.h>
 #include <java_bytecode/java_multi_path_symex_checker.h>
 #include <java_bytecode/java_multi_path_symex_only_checker.h>
 #include <java_bytecode/java_single_path_symex_checker.h>
@@ -154,6 +155,12 @@ void jbmc_parse_optionst::get_command_line_options(optionst &options)
     options.set_option("no-array-field-sensitivity", true);
   }
 
+  if(cmdline.isset("sparse-array-field-sensitivity"))
+    options.set_option("sparse-array-field-sensitivity", true);
+
+  if(cmdline.isset("symex-cone-of-influence"))
+    options.set_option("symex-cone-of-influence", true);
+
   if(cmdline.isset("show-symex-strategies"))
   {
     log.status() << show_path_strategies() << messaget::eom;
@@ -325,6 +332,41 @@ void jbmc_parse_optionst::get_command_line_options(optionst &options)
       "--max-nondet-string-length");
   }
 
+  if(cmdline.isset("incremental-loop"))
+  {
+    throw invalid_command_line_argument_exceptiont(
+      "--incremental-loop is not supported, use --incremental-unwind",
+      "--incremental-loop");
+  }
+
+  if(cmdline.isset("incremental-unwind"))
+  {
+    // string refinement collects its constraints across solver contexts,
+    // hence cannot drop the assertions checked in an earlier round
+    if(options.get_bool_option("refine-strings"))
+    {
+      throw invalid_command_line_argument_exceptiont(
+        "cannot use --incremental-unwind without --no-refine-strings",
+        "--incremental-unwind");
+    }
+
+    if(options.get_bool_option("paths"))
+    {
+      throw invalid_command_line_argument_exceptiont(
+        "cannot use --incremental-unwind with --paths", "--incremental-unwind");
+    }
+
+    options.set_option("incremental-unwind", true);
+    options.set_option("refine", true);
+    options.set_option("refine-arrays", true);
+
+    if(cmdline.isset("unwind-min"))
+      options.set_option("unwind-min", cmdline.get_value("unwind-min"));
+
+    if(cmdline.isset("unwind-max"))
+      options.set_option("unwind-max", cmdline.get_value("unwind-max"));
+  }
+
   if(cmdline.isset("max-node-refinement"))
     options.set_option(
       "max-node-refinement",
@@ -457,6 +499,12 @@ void jbmc_parse_optionst::get_command_line_options(optionst &options)
 
   if(cmdline.isset("show-goto-symex-steps"))
     options.set_option("show-goto-symex-steps", true);
+
+  if(cmdline.isset("symex-memoize-calls"))
+    options.set_option("symex-memoize-calls", true);
+
+  if(cmdline.isset("symex-profile"))
+    options.set_option("symex-profile", true);
 }
 
 /// invoke main modules
@@ -623,7 +671,22 @@ int jbmc_parse_optionst::doit()
 
   std::unique_ptr<goto_verifiert> verifier = nullptr;
 
-  if(
+  if(options.get_bool_option("incremental-unwind"))
+  {
+    if(options.get_bool_option("stop-on-fail"))
+    {
+      verifier = util_make_unique<
+        stop_on_fail_verifiert<java_incremental_unwind_symex_checkert>>(
+        options, ui_message_handler, *goto_model_ptr);
+    }
+    else
+    {
+      verifier = util_make_unique<all_properties_verifier_with_trace_storaget<
+        java_incremental_unwind_symex_checkert>>(
+        options, ui_message_handler, *goto_model_ptr);
+    }
+  }
+  else if(
     options.get_bool_option("stop-on-fail") && options.get_bool_option("paths"))
   {
     verifier =
@@ -903,6 +966,8 @@ bool jbmc_parse_optionst::process_goto_functions(
   goto_modelt &goto_model,
   const optionst &options)
 {
+  scoped_metrics_timert timer("processProgram");
+
   log.status() << "Running GOTO functions transformation passes"
                << messaget::eom;
 
@@ -1134,6 +1199,7 @@ void jbmc_parse_optionst::help()
     HELP_FLUSH
     " --verbosity #                verbosity level\n"
     HELP_TIMESTAMP
+    HELP_METRICS
     "\n";
   // clang-format on
 }
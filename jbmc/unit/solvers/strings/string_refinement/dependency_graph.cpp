@@ -10,16 +10,18 @@ Author: Diffblue Ltd.
 #include <testing-utils/use_catch.h>
 
 #include <java_bytecode/java_types.h>
+#include <solvers/strings/string_constraint_generator.h>
 #include <solvers/strings/string_dependencies.h>
 #include <util/arith_tools.h>
+#include <util/namespace.h>
 #include <util/std_expr.h>
 #include <util/std_types.h>
+#include <util/symbol_table.h>
 
 #ifdef DEBUG
 #include <iostream>
 #include <java_bytecode/java_bytecode_language.h>
 #include <langapi/mode.h>
-#include <util/symbol_table.h>
 #endif
 
 typet length_type()
@@ -193,3 +195,114 @@ SCENARIO("dependency_graph", "[core][solvers][refinement][string_refinement]")
     }
   }
 }
+
+static bool is_empty(const string_constraintst &constraints)
+{
+  return constraints.existential.empty() && constraints.universal.empty() &&
+         constraints.not_contains.empty();
+}
+
+SCENARIO(
+  "dependency_graph_add_constraints",
+  "[core][solvers][refinement][string_refinement]")
+{
+  GIVEN("dependency graph receiving new equations between calls")
+  {
+    // Each call to string_refinementt::dec_solve adds the equations of the
+    // properties checked since the previous call, and adds the constraints
+    // returned by add_constraints to the same solver.
+    symbol_tablet symbol_table;
+    const namespacet ns(symbol_table);
+    string_constraint_generatort generator(ns);
+    string_dependenciest dependencies;
+    const typet string_type =
+      refined_string_typet(java_int_type(), pointer_type(java_char_type()));
+    const auto string1 = make_string_argument("string1");
+    const auto string2 = make_string_argument("string2");
+    const auto string3 = make_string_argument("string3");
+    const auto string4 = make_string_argument("string4");
+    const auto string5 = make_string_argument("string5");
+    const java_method_typet concat_type(
+      {java_method_typet::parametert(length_type()),
+       java_method_typet::parametert(pointer_type(java_char_type())),
+       java_method_typet::parametert(string_type),
+       java_method_typet::parametert(string_type)},
+      unsignedbv_typet(32));
+    const java_method_typet equal_type(
+      {java_method_typet::parametert(string_type),
+       java_method_typet::parametert(string_type)},
+      bool_typet());
+
+    // s3 = s1.concat(s2)
+    const function_application_exprt concat1(
+      symbol_exprt(ID_cprover_string_concat_func, concat_type),
+      {string3.op0(), string3.op1(), string1, string2},
+      concat_type);
+    // s5 = s3.concat(s4)
+    const function_application_exprt concat2(
+      symbol_exprt(ID_cprover_string_concat_func, concat_type),
+      {string5.op0(), string5.op1(), string3, string4},
+      concat_type);
+    // s3.equals(s1), whose arguments need to have a refined string type
+    const function_application_exprt equal(
+      symbol_exprt(ID_cprover_string_equal_func, equal_type),
+      {struct_exprt(string3.operands(), string_type),
+       struct_exprt(string1.operands(), string_type)},
+      bool_typet());
+
+    REQUIRE(add_node(
+              dependencies,
+              equal_exprt(symbol_exprt("lhs1", unsignedbv_typet(32)), concat1),
+              generator.array_pool,
+              generator.fresh_symbol)
+              .has_value());
+    REQUIRE(add_node(
+              dependencies,
+              equal_exprt(symbol_exprt("lhs2", unsignedbv_typet(32)), concat2),
+              generator.array_pool,
+              generator.fresh_symbol)
+              .has_value());
+
+    WHEN("No test depends on the builtin functions")
+    {
+      const string_constraintst first = dependencies.add_constraints(generator);
+      const string_constraintst second =
+        dependencies.add_constraints(generator);
+
+      THEN("Only their length is constrained, and only once")
+      {
+        REQUIRE(first.existential.size() == 2);
+        REQUIRE(first.universal.empty());
+        REQUIRE(first.not_contains.empty());
+        REQUIRE(is_empty(second));
+      }
+    }
+
+    WHEN("A test on the result of one of them is added after the first call")
+    {
+      const string_constraintst first = dependencies.add_constraints(generator);
+      REQUIRE(first.existential.size() == 2);
+
+      REQUIRE(add_node(
+                dependencies,
+                equal_exprt(symbol_exprt("lhs3", bool_typet()), equal),
+                generator.array_pool,
+                generator.fresh_symbol)
+                .has_value());
+      const string_constraintst second =
+        dependencies.add_constraints(generator);
+      const string_constraintst third = dependencies.add_constraints(generator);
+
+      THEN("The test and the function it depends on are fully constrained")
+      {
+        REQUIRE_FALSE(second.universal.empty());
+        REQUIRE_FALSE(second.existential.empty());
+      }
+
+      THEN("Nothing is added once all nodes are constrained")
+      {
+        REQUIRE(is_empty(third));
+      }
+    }
+  }
+}
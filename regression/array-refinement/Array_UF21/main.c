@@ -0,0 +1,21 @@
+int main(void)
+{
+  int a[10];
+  unsigned i, j, k, m;
+  _Bool c;
+  __CPROVER_assume(i < 10 && j < 10 && k < 10 && m < 10);
+
+  if(c)
+    a[i] = 1;
+  else
+    a[j] = 2;
+
+  // a is now an if-term over arrays, read at indices that are only related
+  // to each other in the solver
+  if(k == m)
+    __CPROVER_assert(a[k] == a[m], "functional consistency");
+  __CPROVER_assert(!c || k != i || a[k] == 1, "then branch");
+  __CPROVER_assert(c || a[k] == 2, "else branch");
+
+  return 0;
+}
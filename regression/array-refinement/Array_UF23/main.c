@@ -0,0 +1,19 @@
+int main(void)
+{
+  unsigned n, k, m;
+  __CPROVER_assume(n > 8 && n < 1000);
+  char buf[n];
+  __CPROVER_assume(k < n - 4 && m < n);
+
+  // a byte-wise update of an array of non-constant size, which is turned
+  // into an array comprehension
+  int x;
+  *(int *)(buf + k) = x;
+
+  if(m == k)
+    __CPROVER_assert(buf[m] == buf[k], "functional consistency");
+  __CPROVER_assert(m != k || buf[m] == (char)x, "lowest byte");
+  __CPROVER_assert(buf[k + 4] == (char)x, "next byte");
+
+  return 0;
+}
@@ -0,0 +1,13 @@
+int main(void)
+{
+  int a[10];
+  unsigned i, k;
+  __CPROVER_assume(i < 10 && k < 10);
+
+  a[i] = 5;
+
+  __CPROVER_assert(k != i || a[k] == 5, "read after write");
+  __CPROVER_assert(a[k] == 5, "other index");
+
+  return 0;
+}
@@ -0,0 +1,21 @@
+#include <pthread.h>
+
+int x;
+
+void *writer(void *arg)
+{
+  x = 3;
+  return 0;
+}
+
+int main()
+{
+  pthread_t t;
+  pthread_create(&t, 0, writer, 0);
+  x = 1;
+  x = 2;
+  int y = x;
+  __CPROVER_assert(y == 2 || y == 3, "earlier own write is hidden");
+  __CPROVER_assert(y == 2, "other thread may write");
+  return 0;
+}
@@ -0,0 +1,13 @@
+extern int nondet_int();
+int main()
+{
+  int x = nondet_int();
+  __CPROVER_assume(0 <= x && x <= 1);
+  for(int i = 0; i < 2; ++i) // main.0
+    x = x + 1;
+  while(x < 6) // main.1
+  {
+    x = x + 1;
+    assert(x < 6);
+  }
+}
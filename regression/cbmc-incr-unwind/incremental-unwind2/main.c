@@ -0,0 +1,14 @@
+extern int nondet_int();
+int main()
+{
+  int x = nondet_int();
+  __CPROVER_assume(0 <= x && x <= 1);
+  for(int i = 0; i < 2; ++i) // main.0
+  {
+    int y = 3;
+    while(y > 0) // main.1
+      --y;
+    x = x + y + 1;
+  }
+  assert(x <= 3);
+}
@@ -0,0 +1,11 @@
+extern int nondet_int();
+int main()
+{
+  int n = 0;
+  while(nondet_int()) // main.0
+    ++n;
+  int x = 0;
+  for(int i = 0; i < 3; ++i) // main.1
+    x = x + 2;
+  assert(n + x != 8);
+}
@@ -0,0 +1,16 @@
+#!/usr/bin/env bash
+
+cbmc=$1
+
+options=${*:2:$#-2}
+name=${*:$#}
+
+checkpoint_dir="$(mktemp -d)"
+trap 'rm -rf "${checkpoint_dir}"' EXIT
+checkpoint="${checkpoint_dir}/$(basename "${name%.c}").chk"
+
+# Stop at the first failure, leaving the paths still to be explored in the
+# checkpoint, and then resume from it.
+"${cbmc}" "${name}" ${options} --stop-on-fail \
+  --paths-checkpoint "${checkpoint}" > /dev/null
+"${cbmc}" "${name}" ${options} --paths-resume "${checkpoint}"
@@ -0,0 +1,13 @@
+int nondet_int();
+
+int main()
+{
+  int n = 0;
+  do
+  {
+    ++n;
+  } while(nondet_int());
+  __CPROVER_assert(n != 2, "two iterations");
+  __CPROVER_assert(n != 3, "three iterations");
+  return 0;
+}
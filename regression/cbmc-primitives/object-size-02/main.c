@@ -0,0 +1,27 @@
+#include <assert.h>
+#include <stdlib.h>
+
+int nondet_int();
+
+void main()
+{
+  char a[2];
+  int b[3];
+  char *m1 = malloc(5);
+  char *m2 = malloc(7);
+
+  int choice = nondet_int();
+  char *p = choice == 0 ? a : choice == 1 ? (char *)b : choice == 2 ? m1 : m2;
+
+  assert(
+    __CPROVER_OBJECT_SIZE(p) == 2 || __CPROVER_OBJECT_SIZE(p) == sizeof(b) ||
+    __CPROVER_OBJECT_SIZE(p) == 5 || __CPROVER_OBJECT_SIZE(p) == 7);
+  assert(__CPROVER_DYNAMIC_OBJECT(p) != (choice == 0 || choice == 1));
+  if(choice == 2)
+    assert(__CPROVER_OBJECT_SIZE(p) == 5);
+
+  assert(__CPROVER_OBJECT_SIZE(p) != 7);
+  assert(!__CPROVER_DYNAMIC_OBJECT(p));
+  if(choice == 1)
+    assert(__CPROVER_OBJECT_SIZE(p) == 2);
+}
@@ -0,0 +1,9 @@
+#include <assert.h>
+
+int main(int argc, char **argv)
+{
+  int array[1000];
+  array[argc] = 1;
+  array[1] = argc;
+  assert(array[1] == argc);
+}
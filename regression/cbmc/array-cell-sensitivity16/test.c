@@ -0,0 +1,22 @@
+#include <assert.h>
+
+char buffer[4096];
+
+int main(int argc, char **argv)
+{
+  unsigned i;
+  __CPROVER_assume(i >= 8 && i < 4096);
+
+  buffer[0] = 1;
+  buffer[4] = 2;
+  buffer[i] = 3;
+
+  assert(buffer[0] == 1);
+  assert(buffer[4] == 2);
+  assert(buffer[i] == 3);
+  assert(buffer[5] == 0);
+
+  // may overwrite a tracked cell
+  buffer[i - 4] = 4;
+  assert(buffer[4] == 2);
+}
@@ -0,0 +1,33 @@
+struct node
+{
+  int value;
+  struct node *next;
+};
+
+int main()
+{
+  struct node n1, n2, n3;
+  n1.value = 1;
+  n2.value = 2;
+  n3.value = 3;
+  n1.next = &n2;
+  n2.next = &n3;
+  n3.next = &n1;
+
+  _Bool choice;
+  struct node *p = choice ? &n1 : &n2;
+
+  // repeated dereferences of an unchanged pointer
+  int sum = p->value + p->value + p->next->value;
+  __CPROVER_assert(sum == 4 || sum == 7, "unchanged pointer");
+
+  // the points-to set of p changes, so must its dereference
+  p = p->next;
+  __CPROVER_assert(p->value == 2 || p->value == 3, "updated pointer");
+
+  // the same pointer expression now points elsewhere
+  n2.next = &n1;
+  __CPROVER_assert(p->next->value == 1, "updated field");
+
+  return 0;
+}
@@ -0,0 +1,16 @@
+int fact(int n)
+{
+  if(n <= 1)
+    return 1;
+  return n * fact(n - 1);
+}
+
+int main()
+{
+  int n;
+  __CPROVER_assume(0 <= n && n < 10);
+  if(n > 5)
+    fact(n);
+  else
+    assert(n > 5);
+}
@@ -0,0 +1,20 @@
+int unused;
+
+int f(int x)
+{
+  return x * 2;
+}
+
+int main(int argc, char *argv[])
+{
+  int counter = 0;
+  int value = argc;
+  for(int i = 0; i < 3; ++i)
+  {
+    counter = counter * 7 + i;
+    unused = f(counter);
+  }
+  value = f(value);
+  __CPROVER_assert(value == 2 * argc, "property depends on value only");
+  return 0;
+}
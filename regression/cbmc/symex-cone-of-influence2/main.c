@@ -0,0 +1,18 @@
+int global;
+
+void set(int *p, int v)
+{
+  *p = v;
+}
+
+int main()
+{
+  int local = 1;
+  int irrelevant = 5;
+  set(&local, 2);
+  global = local + 1;
+  irrelevant = global;
+  __CPROVER_assert(global == 2, "fails");
+  __CPROVER_assert(local == 2, "holds");
+  return 0;
+}
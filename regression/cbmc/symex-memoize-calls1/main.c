@@ -0,0 +1,36 @@
+int g;
+
+int square(int x)
+{
+  int r = x * x;
+  if(x < 0)
+    r = -r;
+  return r;
+}
+
+int add_g(int x)
+{
+  return x + g;
+}
+
+int main()
+{
+  int a = square(3);
+  int b = square(3);
+  __CPROVER_assert(a == 9 && b == 9, "same arguments");
+
+  int c = square(-2);
+  __CPROVER_assert(c == -4, "other arguments");
+
+  g = 1;
+  int d = add_g(1);
+  g = 2;
+  int e = add_g(1);
+  __CPROVER_assert(d == 2 && e == 3, "reads a global");
+
+  int n;
+  int f = square(n);
+  __CPROVER_assert(f == 9, "non-constant argument");
+
+  return 0;
+}
@@ -0,0 +1,16 @@
+int positive(int x)
+{
+  if(x > 0)
+    return x;
+}
+
+int main()
+{
+  int a = positive(1);
+  int b = positive(-1);
+  int c = positive(2);
+  int d = positive(-1);
+  __CPROVER_assert(a == 1 && c == 2, "positive arguments");
+
+  return 0;
+}
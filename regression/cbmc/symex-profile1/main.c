@@ -0,0 +1,15 @@
+int sum(int n)
+{
+  int s = 0;
+  for(int i = 0; i < n; ++i)
+    s += i;
+  return s;
+}
+
+int main()
+{
+  int n;
+  __CPROVER_assume(n >= 0 && n <= 3);
+  __CPROVER_assert(sum(n) <= 3, "bounded sum");
+  return 0;
+}
@@ -0,0 +1,8 @@
+#include <assert.h>
+
+int main()
+{
+  int x;
+  assert(x != 42);
+  return 0;
+}
@@ -0,0 +1,473 @@
+#!/usr/bin/env python3
+
+"""
+Measure the performance of a tool over directories of regression tests on the
+local machine, and compare the results of two builds.
+
+  local_perf_test.py run --tool build/bin/cbmc --output baseline.json \\
+    regression/cbmc regression/cbmc-library
+  local_perf_test.py run --tool new/bin/cbmc --output candidate.json \\
+    regression/cbmc regression/cbmc-library
+  local_perf_test.py compare baseline.json candidate.json
+
+The tests are run by regression/test.pl, so the usual test.desc files, levels
+and tags apply, and each test is still checked against its expected output.
+test.pl runs this script in place of the tool, which then runs the tool and
+records its wall-clock time, CPU time and peak resident set size. With
+--metrics, the tool is also asked for its --metrics-json report, which
+includes the time spent in each phase and the size of the SAT instance.
+
+Every test is run --repetitions times. The comparison uses the Mann-Whitney U
+test on the samples of each test, and controls the false discovery rate over
+all tests with the Benjamini-Hochberg procedure. A test is reported as a
+regression if its difference is significant and its median changed by more
+than --threshold. With few repetitions only large, consistent differences can
+be significant; use at least five repetitions, and more for noisy tests.
+"""
+
+import argparse
+import datetime
+import json
+import math
+import os
+import platform
+import resource
+import signal
+import subprocess
+import sys
+import tempfile
+import time
+
+# suffix of the output and log files of test.pl, which keeps them apart from
+# those of normal test runs
+TEST_PL_SUFFIX = 'perf'
+
+
+def same_dir(filename):
+    d = os.path.dirname(os.path.abspath(__file__))
+    return os.path.join(d, filename)
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    subparsers = parser.add_subparsers(dest='command')
+    subparsers.required = True
+
+    run = subparsers.add_parser(
+        'run', help='run regression tests and record their performance')
+    run.add_argument('--tool', type=str, required=True,
+                     help='tool to run the tests on')
+    run.add_argument('--output', type=str, required=True,
+                     help='file to write the results to in JSON format')
+    run.add_argument('--repetitions', type=int, default=5,
+                     help='number of times to run each test (default: 5)')
+    run.add_argument('--metrics', action='store_true',
+                     help='record the --metrics-json report of the tool')
+    run.add_argument('--test', type=str, default=[], action='append',
+                     help='only run the test in this subdirectory of each ' +
+                          'suite [may repeat]')
+    run.add_argument('--test-pl', type=str,
+                     default=same_dir('../../regression/test.pl'),
+                     help='test.pl script to run the tests with')
+    run.add_argument('--test-pl-option', type=str, default=[],
+                     action='append',
+                     help='option to pass to test.pl, such as -C, -K or ' +
+                          '-X<tag> [may repeat]')
+    run.add_argument('suites', type=str, nargs='+',
+                     help='directories containing one test per ' +
+                          'subdirectory, such as regression/cbmc')
+
+    compare = subparsers.add_parser(
+        'compare', help='compare the results of two runs')
+    compare.add_argument('baseline', type=str,
+                         help='results of the baseline build')
+    compare.add_argument('candidate', type=str,
+                         help='results of the build to evaluate')
+    compare.add_argument('--alpha', type=float, default=0.05,
+                         help='false discovery rate (default: 0.05)')
+    compare.add_argument('--threshold', type=float, default=0.05,
+                         help='smallest relative change of the median to ' +
+                              'report (default: 0.05)')
+    compare.add_argument('--min-time', type=float, default=0.1,
+                         help='ignore the times of tests that take less ' +
+                              'than this many seconds (default: 0.1)')
+    compare.add_argument('--json', type=str,
+                         help='also write the report to this file')
+
+    # invoked by test.pl in place of the tool
+    wrap = subparsers.add_parser('wrap')
+    wrap.add_argument('--log', type=str, required=True)
+    wrap.add_argument('--suite', type=str, required=True)
+    wrap.add_argument('--metrics', action='store_true')
+    wrap.add_argument('tool', type=str)
+    wrap.add_argument('test_name', type=str)
+    wrap.add_argument('arguments', nargs=argparse.REMAINDER)
+
+    return parser.parse_args()
+
+
+def peak_rss_of_children():
+    maxrss = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss
+    # reported in bytes on macOS and in kilobytes elsewhere
+    return maxrss if sys.platform == 'darwin' else maxrss * 1024
+
+
+def wrap(args):
+    """
+    Run the tool on one test as test.pl would, and append a record of its
+    performance to the log. The exit code or signal of the tool is passed on,
+    so that test.pl checks the test as usual.
+    """
+    arguments = list(args.arguments)
+    metrics_file = None
+    if args.metrics:
+        fd, metrics_file = tempfile.mkstemp(suffix='.json')
+        os.close(fd)
+        arguments = ['--metrics-json', metrics_file] + arguments
+
+    usage_before = resource.getrusage(resource.RUSAGE_CHILDREN)
+    start = time.monotonic()
+    process = subprocess.Popen([args.tool] + arguments)
+    # forward interrupts to the tool only
+    signal.signal(signal.SIGINT, signal.SIG_IGN)
+    returncode = process.wait()
+    wall = time.monotonic() - start
+    usage_after = resource.getrusage(resource.RUSAGE_CHILDREN)
+
+    # test.pl passes the name of the test.desc file with the suffix appended
+    test_name = args.test_name
+    if test_name.endswith('-' + TEST_PL_SUFFIX):
+        test_name = test_name[:-len(TEST_PL_SUFFIX) - 1]
+
+    record = {
+        'test': os.path.join(args.suite, os.path.basename(os.getcwd()),
+                             test_name + '.desc'),
+        'wall': wall,
+        'cpu': (usage_after.ru_utime - usage_before.ru_utime +
+                usage_after.ru_stime - usage_before.ru_stime),
+        'peakRSS': peak_rss_of_children(),
+        'exitCode': returncode,
+    }
+
+    if metrics_file is not None:
+        try:
+            with open(metrics_file) as f:
+                record['metrics'] = json.load(f)
+        except (OSError, ValueError):
+            pass
+        os.remove(metrics_file)
+
+    # a single write of a line is atomic when test.pl runs tests in parallel
+    with open(args.log, 'a') as log:
+        log.write(json.dumps(record) + '\n')
+
+    if returncode < 0:
+        signal.signal(-returncode, signal.SIG_DFL)
+        os.kill(os.getpid(), -returncode)
+    return returncode
+
+
+def run(args):
+    if args.repetitions < 1:
+        sys.exit('--repetitions must be at least 1')
+
+    tool = os.path.abspath(args.tool)
+    test_pl = os.path.abspath(args.test_pl)
+
+    fd, log = tempfile.mkstemp(suffix='.jsonl')
+    os.close(fd)
+
+    command = [sys.executable, os.path.abspath(__file__), 'wrap',
+               '--log', log]
+    if args.metrics:
+        command.append('--metrics')
+
+    failed_suites = set()
+    try:
+        for repetition in range(args.repetitions):
+            for suite in args.suites:
+                suite_name = os.path.basename(os.path.abspath(suite))
+                wrapper = ' '.join(
+                    "'" + c + "'"
+                    for c in command + ['--suite', suite_name, tool])
+                print('Repetition {}/{}: {}'.format(
+                    repetition + 1, args.repetitions, suite), flush=True)
+                # -f passes the name of the test to the wrapper
+                result = subprocess.run(
+                    ['perl', test_pl, '-c', wrapper, '-f',
+                     '-s', TEST_PL_SUFFIX] +
+                    args.test_pl_option + args.test,
+                    cwd=suite)
+                if result.returncode != 0:
+                    failed_suites.add(suite)
+
+        tests = {}
+        with open(log) as f:
+            for line in f:
+                record = json.loads(line)
+                name = record.pop('test')
+                tests.setdefault(name, {'samples': []})
+                tests[name]['samples'].append(record)
+    finally:
+        os.remove(log)
+
+    results = {
+        'tool': tool,
+        'host': platform.node(),
+        'date': datetime.datetime.now().isoformat(),
+        'repetitions': args.repetitions,
+        'failedSuites': sorted(failed_suites),
+        'tests': tests,
+    }
+
+    with open(args.output, 'w') as f:
+        json.dump(results, f, indent=2, sort_keys=True)
+
+    print('Recorded {} tests in {}'.format(len(tests), args.output))
+    if failed_suites:
+        print('Some tests failed in: ' + ', '.join(sorted(failed_suites)))
+        return 1
+    return 0
+
+
+def median(values):
+    ordered = sorted(values)
+    n = len(ordered)
+    if n % 2 == 1:
+        return ordered[n // 2]
+    return (ordered[n // 2 - 1] + ordered[n // 2]) / 2
+
+
+def ranks(values):
+    """
+    Return the ranks of the values, starting at 1, with tied values getting
+    the average of their ranks, and the sizes of the groups of ties
+    """
+    order = sorted(range(len(values)), key=lambda i: values[i])
+    result = [0.0] * len(values)
+    ties = []
+    i = 0
+    while i < len(order):
+        j = i
+        while j + 1 < len(order) and values[order[j + 1]] == values[order[i]]:
+            j += 1
+        for k in range(i, j + 1):
+            result[order[k]] = (i + j) / 2 + 1
+        ties.append(j - i + 1)
+        i = j + 1
+    return result, ties
+
+
+def u_distribution(n, m):
+    """
+    Return the number of arrangements of n and m samples for each value of
+    the Mann-Whitney U statistic, when there are no ties
+    """
+    # counts[i][j] is the distribution for i and j samples
+    counts = [[None] * (m + 1) for _ in range(n + 1)]
+    for i in range(n + 1):
+        for j in range(m + 1):
+            if i == 0 or j == 0:
+                counts[i][j] = [1]
+                continue
+            # the largest sample comes either from the first group, and is
+            # greater than all j samples of the second, or from the second
+            with_first = [0] * j + counts[i - 1][j]
+            with_second = counts[i][j - 1]
+            size = max(len(with_first), len(with_second))
+            counts[i][j] = [
+                (with_first[u] if u < len(with_first) else 0) +
+                (with_second[u] if u < len(with_second) else 0)
+                for u in range(size)]
+    return counts[n][m]
+
+
+def mann_whitney_u(x, y):
+    """
+    Return the two-sided p-value of the Mann-Whitney U test of whether the
+    samples x and y come from the same distribution
+    """
+    n, m = len(x), len(y)
+    if n == 0 or m == 0:
+        return 1.0
+
+    r, ties = ranks(list(x) + list(y))
+    u = sum(r[:n]) - n * (n + 1) / 2
+
+    if all(t == 1 for t in ties) and n + m <= 40:
+        counts = u_distribution(n, m)
+        total = sum(counts)
+        u = int(round(u))
+        lower = sum(counts[:u + 1]) / total
+        upper = sum(counts[u:]) / total
+        return min(1.0, 2 * min(lower, upper))
+
+    # normal approximation with correction for ties and continuity
+    mean = n * m / 2
+    total = n + m
+    variance = n * m / 12 * (
+        total + 1 - sum(t ** 3 - t for t in ties) / (total * (total - 1)))
+    if variance <= 0:
+        return 1.0
+    z = max(0.0, abs(u - mean) - 0.5) / math.sqrt(variance)
+    return math.erfc(z / math.sqrt(2))
+
+
+def benjamini_hochberg(p_values):
+    """
+    Return the q-values for the p-values, which control the false discovery
+    rate over all of them
+    """
+    m = len(p_values)
+    order = sorted(range(m), key=lambda i: p_values[i])
+    q_values = [1.0] * m
+    smallest = 1.0
+    for rank in range(m, 0, -1):
+        i = order[rank - 1]
+        smallest = min(smallest, p_values[i] * m / rank)
+        q_values[i] = smallest
+    return q_values
+
+
+MEASURES = ['wall', 'cpu', 'peakRSS']
+TIME_MEASURES = ['wall', 'cpu']
+# metrics that should not change unless the encoding changes
+SIZE_METRICS = [('counters', 'ssaSteps'), ('gauges', 'satVariables'),
+                ('gauges', 'satClauses')]
+
+
+def size_metrics(samples):
+    result = {}
+    metrics = samples[-1].get('metrics')
+    if metrics is None:
+        return result
+    for group, name in SIZE_METRICS:
+        if name in metrics.get(group, {}):
+            result[name] = metrics[group][name]
+    return result
+
+
+def compare(args):
+    with open(args.baseline) as f:
+        baseline = json.load(f)['tests']
+    with open(args.candidate) as f:
+        candidate = json.load(f)['tests']
+
+    common = sorted(set(baseline) & set(candidate))
+    comparisons = []
+    for measure in MEASURES:
+        for test in common:
+            base_samples = [s[measure] for s in baseline[test]['samples']]
+            new_samples = [s[measure] for s in candidate[test]['samples']]
+            base_median = median(base_samples)
+            if measure in TIME_MEASURES and base_median < args.min_time:
+                continue
+            new_median = median(new_samples)
+            comparisons.append({
+                'test': test,
+                'measure': measure,
+                'baseline': base_median,
+                'candidate': new_median,
+                'ratio': (new_median / base_median if base_median > 0
+                          else float('inf') if new_median > 0 else 1.0),
+                'p': mann_whitney_u(base_samples, new_samples),
+            })
+
+    for measure in MEASURES:
+        selected = [c for c in comparisons if c['measure'] == measure]
+        for c, q in zip(selected, benjamini_hochberg(
+                [c['p'] for c in selected])):
+            c['q'] = q
+            significant = q < args.alpha
+            if significant and c['ratio'] > 1 + args.threshold:
+                c['change'] = 'regression'
+            elif significant and c['ratio'] < 1 - args.threshold:
+                c['change'] = 'improvement'
+            else:
+                c['change'] = 'none'
+
+    size_changes = []
+    for test in common:
+        base_sizes = size_metrics(baseline[test]['samples'])
+        new_sizes = size_metrics(candidate[test]['samples'])
+        for name in sorted(set(base_sizes) & set(new_sizes)):
+            if base_sizes[name] != new_sizes[name]:
+                size_changes.append({
+                    'test': test, 'metric': name,
+                    'baseline': base_sizes[name],
+                    'candidate': new_sizes[name]})
+
+    summary = {}
+    for measure in MEASURES:
+        ratios = [c['ratio'] for c in comparisons
+                  if c['measure'] == measure and 0 < c['ratio'] < math.inf]
+        summary[measure] = {
+            'tests': len(ratios),
+            'geometricMeanRatio': (
+                math.exp(sum(math.log(r) for r in ratios) / len(ratios))
+                if ratios else 1.0),
+            'regressions': sum(1 for c in comparisons
+                               if c['measure'] == measure and
+                               c['change'] == 'regression'),
+            'improvements': sum(1 for c in comparisons
+                                if c['measure'] == measure and
+                                c['change'] == 'improvement'),
+        }
+
+    report = {
+        'summary': summary,
+        'changes': [c for c in comparisons if c['change'] != 'none'],
+        'sizeChanges': size_changes,
+        'onlyInBaseline': sorted(set(baseline) - set(candidate)),
+        'onlyInCandidate': sorted(set(candidate) - set(baseline)),
+    }
+
+    print('{:<10} {:>6} {:>12} {:>12} {:>13}'.format(
+        'measure', 'tests', 'mean ratio', 'regressions', 'improvements'))
+    for measure in MEASURES:
+        s = summary[measure]
+        print('{:<10} {:>6} {:>12.3f} {:>12} {:>13}'.format(
+            measure, s['tests'], s['geometricMeanRatio'], s['regressions'],
+            s['improvements']))
+
+    if report['changes']:
+        print('\nSignificant changes:')
+        for c in sorted(report['changes'],
+                        key=lambda c: (c['measure'], -c['ratio'])):
+            print('  {:<11} {:<8} {:>7.3f}x  {:.4g} -> {:.4g}  q={:.3g}  {}'
+                  .format(c['change'], c['measure'], c['ratio'],
+                          c['baseline'], c['candidate'], c['q'], c['test']))
+
+    if size_changes:
+        print('\nChanged problem sizes:')
+        for c in size_changes:
+            print('  {:<13} {} -> {}  {}'.format(
+                c['metric'], c['baseline'], c['candidate'], c['test']))
+
+    for key, text in [('onlyInBaseline', 'Only in baseline'),
+                      ('onlyInCandidate', 'Only in candidate')]:
+        if report[key]:
+            print('\n{}: {}'.format(text, ', '.join(report[key])))
+
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump(report, f, indent=2, sort_keys=True)
+
+    regressions = sum(s['regressions'] for s in summary.values())
+    return 1 if regressions > 0 else 0
+
+
+def main():
+    args = parse_args()
+    if args.command == 'wrap':
+        return wrap(args)
+    elif args.command == 'run':
+        return run(args)
+    else:
+        return compare(args)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -291,7 +291,7 @@ BigInt::reallocate (unsigned digits)
 {
   if (digits > size)
     {
-      if (size)
+      if (size && !is_inline())
 	delete[] digit;
       size = adjust_size (digits);
       digit = new onedig_t[size];
@@ -313,7 +313,7 @@ BigInt::resize (unsigned digits)
       if (old_digit)
 	{
 	  memcpy (digit, old_digit, length * sizeof (onedig_t));
-	  if (old_size)
+	  if (old_size && old_digit != inline_digit)
 	    delete[] old_digit;
 	}
     }
@@ -360,6 +360,21 @@ digit_set (ullong_t ul, onedig_t d[small], unsigned &l)
     }
 }
 
+// Load string of at most small onedig_t into unsigned elementary
+// integer type. Not part of original BigInt.
+
+inline ullong_t
+digit_get (onedig_t const *d, unsigned l)
+{
+  ullong_t ul = 0;
+  while (l-- > 0)
+    {
+      ul <<= single_bits;
+      ul |= d[l];
+    }
+  return ul;
+}
+
 void
 BigInt::assign (ullong_t ul)
 {
@@ -386,7 +401,7 @@ BigInt::assign (llong_t l)
 
 BigInt::~BigInt()
 {
-  if (size > 0)
+  if (size > 0 && !is_inline())
     {
       memset (digit, 0, size * sizeof digit[0]); // Crypto-paranoia.
       delete[] digit;
@@ -401,64 +416,65 @@ BigInt::BigInt (onedig_t *dig, unsigned len, bool pos)
 {}
 
 BigInt::BigInt()
-  : size (adjust_size (small)),
+  : size (inline_size),
     length (0),
-    digit (new onedig_t[size]),
+    digit (inline_digit),
     positive (true)
 {}
 
 BigInt::BigInt (signed long int n)
-  : size (adjust_size (small)),
+  : size (inline_size),
     length (0),
-    digit (new onedig_t[size])
+    digit (inline_digit)
 {
   assign (llong_t (n));
 }
 
 BigInt::BigInt (unsigned long int n)
-  : size (adjust_size (small)),
+  : size (inline_size),
     length (0),
-    digit (new onedig_t[size])
+    digit (inline_digit)
 {
   assign (ullong_t (n));
 }
 
 BigInt::BigInt (int n)
-  : size (adjust_size (small)),
+  : size (inline_size),
     length (0),
-    digit (new onedig_t[size])
+    digit (inline_digit)
 {
   assign (llong_t (n));
 }
 
 BigInt::BigInt (unsigned u)
-  : size (adjust_size (small)),
+  : size (inline_size),
     length (0),
-    digit (new onedig_t[size])
+    digit (inline_digit)
 {
   assign (ullong_t (u));
 }
 
 BigInt::BigInt (llong_t l)
-  : size (adjust_size (small)),
+  : size (inline_size),
     length (0),
-    digit (new onedig_t[size])
+    digit (inline_digit)
 {
   assign (l);
 }
 
 BigInt::BigInt (ullong_t ul)
-  : size (adjust_size (small)),
+  : size (inline_size),
     length (0),
-    digit (new onedig_t[size])
+    digit (inline_digit)
 {
   assign (ul);
 }
 
 BigInt::BigInt (BigInt const &y)
-  : size (adjust_size (y.length)),
+  : size (y.length <= inline_size ? unsigned (inline_size)
+				  : adjust_size (y.length)),
     length (y.length),
-    digit (new onedig_t[size]),
+    digit (y.length <= inline_size ? inline_digit : new onedig_t[size]),
     positive (y.positive)
 {
   memcpy (digit, y.digit, length * sizeof (onedig_t));
@@ -471,9 +487,9 @@ BigInt::BigInt (BigInt &&y)
 }
 
 BigInt::BigInt (char const *s, onedig_t b)
-  : size (adjust_size (small)),
+  : size (inline_size),
     length (0),
-    digit (new onedig_t[size]),
+    digit (inline_digit),
     positive (true)
 {
   scan (s, b);
@@ -778,6 +794,33 @@ BigInt::compare (BigInt const &b) const
 void
 BigInt::add (onedig_t const *dig, unsigned len, bool pos)
 {
+  // Use native arithmetic if both operands are elementary integers
+  // and the result does not overflow. Not part of original BigInt.
+  if (length <= small && len <= small)
+    {
+      ullong_t a = to_ulong();
+      ullong_t b = digit_get (dig, len);
+      ullong_t c;
+      if (positive != pos)
+	{
+	  if (a < b)
+	    {
+	      c = b - a;
+	      positive = pos;
+	    }
+	  else
+	    c = a - b;
+	}
+      else if ((c = a + b) < a)
+	goto overflow;
+      resize (small);
+      digit_set (c, digit, length);
+      if (length == 0)
+	positive = true;
+      return;
+    }
+ overflow:
+
   // Make sure the result fits into this, even with carry.
   resize ((length > len ? length : len) + 1);
 
@@ -870,6 +913,20 @@ BigInt::mul (onedig_t const *dig, unsigned len, bool pos)
 	    digit[length++] = c;
 	}
     }
+  else if (length + len <= inline_size)
+    {
+      // The result fits on the stack, and then into this without
+      // allocating.
+      onedig_t r[inline_size];
+      if (length < len)
+	digit_mul (digit, length, dig, len, r);
+      else
+	digit_mul (dig, len, digit, length, r);
+      length += len;
+      reallocate (length);
+      memcpy (digit, r, length * sizeof (onedig_t));
+      adjust();
+    }
   else
     {
       // Get a new string of digits for the result.
@@ -885,7 +942,7 @@ BigInt::mul (onedig_t const *dig, unsigned len, bool pos)
 	digit_mul (dig, len, digit, length, r);
 
       // Replace digit string of this with result.
-      if (old_size)
+      if (old_size && !is_inline())
 	delete[] digit;
       digit = r;
       length += len;
@@ -128,11 +128,20 @@ public:
   // by an elementary type.
   enum { small = sizeof (ullong_t) / sizeof (onedig_t) };
 
+  // Number of digits stored inline, without allocating. Enough for the
+  // product of any two elementary integers.
+  // Not part of original BigInt.
+  enum { inline_size = 2 * small };
+
 private:
   unsigned size;			// Length of digit vector.
   unsigned length;			// Used places in digit vector.
   onedig_t *digit;			// Least significant first.
   bool positive;			// Signed magnitude representation.
+  onedig_t inline_digit[inline_size];	// Storage for small numbers.
+
+  // True if digit points to inline_digit, which must not be deleted.
+  bool is_inline() const		{ return digit == inline_digit; }
 
   // Create or resize this.
   inline void allocate (unsigned digits);
@@ -283,10 +292,19 @@ public:
 
   void swap (BigInt &other)
   {
+    // Inline digits move with their object, so pointers to them must
+    // be redirected after swapping the contents.
+    const bool was_inline = is_inline();
+    const bool other_was_inline = other.is_inline();
     std::swap(other.size, size);
     std::swap(other.length, length);
     std::swap(other.digit, digit);
     std::swap(other.positive, positive);
+    std::swap(other.inline_digit, inline_digit);
+    if (was_inline)
+      other.digit = other.inline_digit;
+    if (other_was_inline)
+      digit = inline_digit;
   }
 };
 
@@ -39,6 +39,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <goto-checker/all_properties_verifier_with_trace_storage.h>
 #include <goto-checker/bmc_util.h>
 #include <goto-checker/cover_goals_verifier_with_trace_storage.h>
+#include <goto-checker/incremental_unwind_symex_checker.h>
 #include <goto-checker/multi_path_symex_checker.h>
 #include <goto-checker/multi_path_symex_only_checker.h>
 #include <goto-checker/properties.h>
@@ -167,6 +168,12 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
     options.set_option("no-array-field-sensitivity", true);
   }
 
+  if(cmdline.isset("sparse-array-field-sensitivity"))
+    options.set_option("sparse-array-field-sensitivity", true);
+
+  if(cmdline.isset("symex-cone-of-influence"))
+    options.set_option("symex-cone-of-influence", true);
+
   if(cmdline.isset("partial-loops") && cmdline.isset("unwinding-assertions"))
   {
     log.error()
@@ -373,10 +380,23 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
       "max-node-refinement",
       cmdline.get_value("max-node-refinement"));
 
-  if(cmdline.isset("incremental-loop"))
+  if(cmdline.isset("incremental-loop") || cmdline.isset("incremental-unwind"))
   {
-    options.set_option(
-      "incremental-loop", cmdline.get_value("incremental-loop"));
+    if(cmdline.isset("incremental-loop") && cmdline.isset("incremental-unwind"))
+    {
+      log.error() << "--incremental-loop and --incremental-unwind cannot be "
+                  << "used together" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    if(cmdline.isset("incremental-loop"))
+    {
+      options.set_option(
+        "incremental-loop", cmdline.get_value("incremental-loop"));
+    }
+    else
+      options.set_option("incremental-unwind", true);
+
     options.set_option("refine", true);
     options.set_option("refine-arrays", true);
 
@@ -391,8 +411,8 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
 
     if(cmdline.isset("paths"))
     {
-      log.error() << "--paths not supported with --incremental-loop"
-                  << messaget::eom;
+      log.error() << "--paths not supported with --incremental-loop or "
+                  << "--incremental-unwind" << messaget::eom;
       exit(CPROVER_EXIT_USAGE_ERROR);
     }
   }
@@ -509,6 +529,12 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   if(cmdline.isset("show-goto-symex-steps"))
     options.set_option("show-goto-symex-steps", true);
 
+  if(cmdline.isset("symex-memoize-calls"))
+    options.set_option("symex-memoize-calls", true);
+
+  if(cmdline.isset("symex-profile"))
+    options.set_option("symex-profile", true);
+
   PARSE_OPTIONS_GOTO_TRACE(cmdline, options);
 }
 
@@ -707,6 +733,21 @@ int cbmc_parse_optionst::doit()
         options, ui_message_handler, goto_model);
     }
   }
+  else if(options.get_bool_option("incremental-unwind"))
+  {
+    if(options.get_bool_option("stop-on-fail"))
+    {
+      verifier = util_make_unique<
+        stop_on_fail_verifiert<incremental_unwind_symex_checkert>>(
+        options, ui_message_handler, goto_model);
+    }
+    else
+    {
+      verifier = util_make_unique<all_properties_verifier_with_trace_storaget<
+        incremental_unwind_symex_checkert>>(
+        options, ui_message_handler, goto_model);
+    }
+  }
   else if(
     options.get_bool_option("stop-on-fail") && options.get_bool_option("paths"))
   {
@@ -867,6 +908,8 @@ bool cbmc_parse_optionst::process_goto_program(
   const optionst &options,
   messaget &log)
 {
+  scoped_metrics_timert timer("processProgram");
+
   // Remove inline assembler; this needs to happen before
   // adding the library.
   remove_asm(goto_model);
@@ -1123,6 +1166,7 @@ void cbmc_parse_optionst::help()
     HELP_FLUSH
     " --verbosity #                verbosity level\n"
     HELP_TIMESTAMP
+    HELP_METRICS
     " --write-solver-stats-to json-file\n"
     "                              collect the solver query complexity\n"
     "\n";
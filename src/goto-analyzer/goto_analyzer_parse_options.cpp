@@ -540,6 +540,8 @@ int goto_analyzer_parse_optionst::doit()
 /// Depending on the command line mode, run one of the analysis tasks
 int goto_analyzer_parse_optionst::perform_analysis(const optionst &options)
 {
+  scoped_metrics_timert timer("analysis");
+
   adjust_float_expressions(goto_model);
   if(options.get_bool_option("taint"))
   {
@@ -923,6 +925,7 @@ void goto_analyzer_parse_optionst::help()
     " --version                    show version and exit\n"
     HELP_FLUSH
     HELP_TIMESTAMP
+    HELP_METRICS
     "\n";
   // clang-format on
 }
@@ -89,6 +89,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_GOTO_ANALYZER_GOTO_ANALYZER_PARSE_OPTIONS_H
 #define CPROVER_GOTO_ANALYZER_GOTO_ANALYZER_PARSE_OPTIONS_H
 
+#include <util/metrics.h>
 #include <util/parse_options.h>
 #include <util/timestamper.h>
 #include <util/ui_message.h>
@@ -156,6 +157,7 @@ class optionst;
   "(gcc)(arch):" \
   OPT_FLUSH \
   OPT_TIMESTAMP \
+  OPT_METRICS \
   OPT_VALIDATE \
   GOTO_ANALYSER_OPTIONS_TASKS \
   "(no-simplify-slicing)" \
@@ -28,6 +28,7 @@ Author: Daniel Kroening, Peter Schrammel
 #include <solvers/decision_procedure.h>
 
 #include <util/make_unique.h>
+#include <util/metrics.h>
 #include <util/ui_message.h>
 
 #include "goto_symex_property_decider.h"
@@ -78,12 +79,10 @@ void output_error_trace(
     break;
 
   case ui_message_handlert::uit::XML_UI:
-  {
-    xmlt xml;
-    convert(ns, goto_trace, xml);
-    msg.status() << xml;
-  }
-  break;
+    // streamed rather than printed by msg.status(), so check the verbosity
+    if(ui_message_handler.get_verbosity() >= messaget::M_STATUS)
+      convert(ns, goto_trace, ui_message_handler.get_xml_stream());
+    break;
 
   case ui_message_handlert::uit::JSON_UI:
   {
@@ -152,6 +151,8 @@ void convert_symex_target_equation(
   decision_proceduret &decision_procedure,
   message_handlert &message_handler)
 {
+  scoped_metrics_timert timer("convertSSA");
+
   messaget msg(message_handler);
   msg.status() << "converting SSA" << messaget::eom;
 
@@ -302,6 +303,33 @@ void update_status_of_unknown_properties(
   }
 }
 
+void update_path_targets(
+  path_storaget &worklist,
+  abstract_goto_modelt &goto_model,
+  const propertiest &properties,
+  const optionst &options)
+{
+  if(options.get_bool_option("paths-symex-explore-all"))
+    return;
+
+  std::unordered_set<irep_idt> decided_properties;
+  for(const auto &property_pair : properties)
+  {
+    if(!is_property_to_check(property_pair.second.status))
+      decided_properties.insert(property_pair.first);
+  }
+
+  worklist.set_targets(
+    [&goto_model](
+      const irep_idt &id) -> const goto_functionst::goto_functiont * {
+      if(!goto_model.can_produce_function(id))
+        return nullptr;
+      return &goto_model.get_goto_function(id);
+    },
+    decided_properties,
+    options.get_bool_option("unwinding-assertions"));
+}
+
 void output_coverage_report(
   const std::string &cov_out,
   const abstract_goto_modelt &goto_model,
@@ -337,6 +365,7 @@ void postprocess_equation(
   messaget log(ui_message_handler);
   log.statistics() << "size of program expression: "
                    << equation.SSA_steps.size() << " steps" << messaget::eom;
+  get_metrics().add("ssaSteps", equation.SSA_steps.size());
 
   slice(symex, equation, ns, options, ui_message_handler);
 
@@ -106,6 +106,19 @@ void output_coverage_report(
   const symex_bmct &symex,
   ui_message_handlert &ui_message_handler);
 
+/// Informs \p worklist of the properties that have been decided, so that
+/// directed exploration strategies can rank and prune the saved paths.
+/// Does nothing if all paths are to be explored regardless of properties.
+/// \param [in,out] worklist: path storage to update
+/// \param goto_model: goto model providing the function bodies
+/// \param properties: the current status of the properties
+/// \param options: the options of the current run
+void update_path_targets(
+  path_storaget &worklist,
+  abstract_goto_modelt &goto_model,
+  const propertiest &properties,
+  const optionst &options);
+
 /// Sets property status to PASS for properties whose
 /// conditions are constant true in the \p equation.
 /// \param [in,out] properties: The status is updated in this data structure
@@ -176,6 +189,9 @@ void run_property_decider(
   "(show-loops)" \
   "(show-vcc)" \
   "(show-goto-symex-steps)" \
+  "(symex-memoize-calls)" \
+  "(symex-profile)" \
+  "(symex-cone-of-influence)" \
   "(slice-formula)" \
   "(unwinding-assertions)" \
   "(no-unwinding-assertions)" \
@@ -183,25 +199,39 @@ void run_property_decider(
   "(no-self-loops-to-assumptions)" \
   "(partial-loops)" \
   "(paths):" \
+  "(paths-checkpoint):" \
+  "(paths-resume):" \
   "(show-symex-strategies)" \
   "(depth):" \
   "(unwind):" \
   "(max-field-sensitivity-array-size):" \
   "(no-array-field-sensitivity)" \
+  "(sparse-array-field-sensitivity)" \
   "(graphml-witness):" \
   "(unwindset):" \
   "(symex-complexity-limit):" \
   "(symex-complexity-failed-child-loops-limit):" \
   "(incremental-loop):" \
+  "(incremental-unwind)" \
   "(unwind-min):" \
   "(unwind-max):" \
   "(ignore-properties-before-unwind-min)"
 
 #define HELP_BMC \
   " --paths [strategy]           explore paths one at a time\n" \
+  " --paths-checkpoint file      keep the paths still to be explored in\n" \
+  "                              file, to be resumed after an interruption\n" \
+  " --paths-resume file          explore the paths stored in file by\n" \
+  "                              --paths-checkpoint\n" \
   " --show-symex-strategies      list strategies for use with --paths\n" \
   " --show-goto-symex-steps      show which steps symex travels, includes " \
   "                              diagnostic information\n" \
+  " --symex-memoize-calls        reuse the results of calls to side-effect\n" \
+  "                              free functions with constant arguments\n" \
+  " --symex-profile              report where symbolic execution spends its\n" \
+  "                              time, by function, loop and source line\n" \
+  " --symex-cone-of-influence    skip assignments to objects that cannot\n" \
+  "                              affect any assertion, assumption or branch\n" \
   " --program-only               only show program expression\n" \
   " --show-loops                 show the loops in the program\n" \
   " --depth nr                   limit search depth\n" \
@@ -214,12 +244,19 @@ void run_property_decider(
   "this is\n" \
   "                              equivalent to setting the maximum field \n" \
   "                              sensitivity size for arrays to 0\n" \
+  " --sparse-array-field-sensitivity\n" \
+  "                              apply field sensitivity to the elements of\n" \
+  "                              larger arrays that are accessed at\n" \
+  "                              constant indices\n" \
   " --unwind nr                  unwind nr times\n" \
   " --unwindset L:B,...          unwind loop L with a bound of B\n" \
   "                              (use --show-loops to get the loop IDs)\n" \
   " --incremental-loop L         check properties after each unwinding\n" \
   "                              of loop L\n" \
   "                              (use --show-loops to get the loop IDs)\n" \
+  " --incremental-unwind         unwind all loops 1, 2, ... times (starting\n" \
+  "                              at --unwind-min, up to --unwind-max) and\n" \
+  "                              check properties after each round\n" \
   " --unwind-min nr              start incremental-loop after nr unwindings\n" \
   "                              but before solving that iteration. If for\n" \
   "                              example it is 1, then the loop will be\n" \
@@ -14,6 +14,7 @@ Author: Daniel Kroening, Peter Schrammel
 #include <solvers/prop/literal_expr.h>
 #include <solvers/prop/prop.h>
 
+#include <util/metrics.h>
 #include <util/threeval.h>
 
 goto_symex_property_decidert::goto_symex_property_decidert(
@@ -101,6 +102,7 @@ void goto_symex_property_decidert::add_constraint_from_goals(
 
 decision_proceduret::resultt goto_symex_property_decidert::solve()
 {
+  scoped_metrics_timert timer("solve");
   return solver->decision_procedure()();
 }
 
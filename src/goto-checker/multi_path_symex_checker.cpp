@@ -52,6 +52,9 @@ operator()(propertiest &properties)
       symex,
       ui_message_handler);
 
+    if(options.get_bool_option("symex-profile"))
+      symex.get_symex_profile().output(ui_message_handler);
+
     update_properties(properties, result.updated_properties);
 
     // Have we got anything to check? Otherwise we return DONE.
@@ -49,6 +49,9 @@ operator()(propertiest &properties)
     symex,
     ui_message_handler);
 
+  if(options.get_bool_option("symex-profile"))
+    symex.get_symex_profile().output(ui_message_handler);
+
   if(options.get_bool_option("show-vcc"))
   {
     show_vcc(options, ui_message_handler, equation);
@@ -16,6 +16,7 @@ Author: Daniel Kroening, Peter Schrammel
 #include <util/json.h>
 #include <util/json_stream.h>
 #include <util/xml.h>
+#include <util/xml_stream.h>
 
 std::string as_string(resultt result)
 {
@@ -102,14 +103,31 @@ as_string(const irep_idt &property_id, const property_infot &property_info)
          ": " + as_string(property_info.status);
 }
 
+template <class xml_elementT>
+static void xml(
+  xml_elementT &result,
+  const irep_idt &property_id,
+  const property_infot &property_info)
+{
+  result.set_attribute("property", id2string(property_id));
+  result.set_attribute("status", as_string(property_info.status));
+}
+
 xmlt xml(const irep_idt &property_id, const property_infot &property_info)
 {
   xmlt xml_result("result");
-  xml_result.set_attribute("property", id2string(property_id));
-  xml_result.set_attribute("status", as_string(property_info.status));
+  xml<xmlt>(xml_result, property_id, property_info);
   return xml_result;
 }
 
+void xml(
+  xml_streamt &result,
+  const irep_idt &property_id,
+  const property_infot &property_info)
+{
+  xml<xml_streamt>(result, property_id, property_info);
+}
+
 template <class json_objectT>
 static void json(
   json_objectT &result,
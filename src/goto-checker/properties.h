@@ -19,6 +19,7 @@ Author: Daniel Kroening, Peter Schrammel
 class json_objectt;
 class json_stream_objectt;
 class xmlt;
+class xml_streamt;
 
 /// The status of a property
 enum class property_statust
@@ -87,6 +88,9 @@ as_string(const irep_idt &property_id, const property_infot &property_info);
 
 xmlt xml(const irep_idt &property_id, const property_infot &property_info);
 
+/// Write the property info into the given XML stream element
+void xml(xml_streamt &, const irep_idt &, const property_infot &);
+
 json_objectt
 json(const irep_idt &property_id, const property_infot &property_info);
 
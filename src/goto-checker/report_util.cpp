@@ -19,6 +19,7 @@ Author: Daniel Kroening, Peter Schrammel
 #include <util/ui_message.h>
 #include <util/xml.h>
 #include <util/xml_irep.h>
+#include <util/xml_stream.h>
 
 #include <goto-symex/build_goto_trace.h>
 
@@ -378,17 +379,20 @@ void output_properties_with_traces(
   }
   case ui_message_handlert::uit::XML_UI:
   {
+    // streamed rather than printed by log.result(), so check the verbosity
+    if(ui_message_handler.get_verbosity() < messaget::M_RESULT)
+      break;
+
     for(const auto &property_pair : properties)
     {
-      xmlt xml_result = xml(property_pair.first, property_pair.second);
+      xml_streamt &xml_result =
+        ui_message_handler.get_xml_stream().push_back_stream("result");
+      xml(xml_result, property_pair.first, property_pair.second);
       if(property_pair.second.status == property_statust::FAIL)
       {
         convert(
-          traces.get_namespace(),
-          traces[property_pair.first],
-          xml_result.new_element());
+          traces.get_namespace(), traces[property_pair.first], xml_result);
       }
-      log.result() << xml_result;
     }
     break;
   }
@@ -17,6 +17,8 @@ Author: Daniel Kroening, Peter Schrammel
 
 #include <goto-symex/slice.h>
 
+#include <util/metrics.h>
+
 #include "bmc_util.h"
 #include "counterexample_beautification.h"
 
@@ -104,6 +106,7 @@ operator()(propertiest &properties)
       {
         postprocess_equation(symex, equation, options, ns, ui_message_handler);
 
+        scoped_metrics_timert timer("convertSSA");
         log.status() << "converting SSA" << messaget::eom;
         equation.convert_without_assertions(
           property_decider.get_decision_procedure());
@@ -158,6 +161,9 @@ operator()(propertiest &properties)
     // Now we are finally done.
     if(full_equation_generated)
     {
+      if(options.get_bool_option("symex-profile"))
+        symex.get_symex_profile().output(ui_message_handler);
+
       // For now, we assume that UNKNOWN properties are PASS.
       update_status_of_unknown_properties(
         properties, result.updated_properties);
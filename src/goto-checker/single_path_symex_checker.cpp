@@ -51,8 +51,12 @@ operator()(propertiest &properties)
     initialize_worklist();
   }
 
+  update_path_targets(*worklist, goto_model, properties, options);
+
   while(!has_finished_exploration(properties))
   {
+    write_checkpoint();
+
     path_storaget::patht &path = worklist->peek();
     const bool ready_to_decide = resume_path(path);
 
@@ -74,10 +78,17 @@ operator()(propertiest &properties)
     }
 
     worklist->pop();
+    update_path_targets(*worklist, goto_model, properties, options);
   }
 
+  // record that no paths remain
+  write_checkpoint();
+
   final_update_properties(properties, result.updated_properties);
 
+  if(options.get_bool_option("symex-profile"))
+    symex_profile.output(ui_message_handler);
+
   // Worklist is empty: we are done.
   return result;
 }
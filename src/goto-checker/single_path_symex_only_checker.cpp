@@ -12,8 +12,12 @@ Author: Daniel Kroening, Peter Schrammel
 #include "single_path_symex_only_checker.h"
 
 #include <chrono>
+#include <fstream>
+
+#include <util/exception_utils.h>
 
 #include <goto-symex/memory_model_pso.h>
+#include <goto-symex/path_checkpoint.h>
 #include <goto-symex/path_storage.h>
 #include <goto-symex/show_program.h>
 #include <goto-symex/show_vcc.h>
@@ -38,9 +42,12 @@ operator()(propertiest &properties)
   resultt result(resultt::progresst::DONE);
 
   initialize_worklist();
+  update_path_targets(*worklist, goto_model, properties, options);
 
   while(!has_finished_exploration(properties))
   {
+    write_checkpoint();
+
     path_storaget::patht &path = worklist->peek();
 
     (void)resume_path(path);
@@ -48,10 +55,17 @@ operator()(propertiest &properties)
     update_properties(properties, result.updated_properties, path.equation);
 
     worklist->pop();
+    update_path_targets(*worklist, goto_model, properties, options);
   }
 
+  // record that no paths remain
+  write_checkpoint();
+
   final_update_properties(properties, result.updated_properties);
 
+  if(options.get_bool_option("symex-profile"))
+    symex_profile.output(ui_message_handler);
+
   return result;
 }
 
@@ -68,8 +82,37 @@ void single_path_symex_only_checkert::initialize_worklist()
     guard_manager);
   setup_symex(symex);
 
-  symex.initialize_path_storage_from_entry_point_of(
-    goto_symext::get_goto_function(goto_model), symex_symbol_table);
+  const std::string resume_file = options.get_option("paths-resume");
+  if(resume_file.empty())
+  {
+    symex.initialize_path_storage_from_entry_point_of(
+      goto_symext::get_goto_function(goto_model), symex_symbol_table);
+    return;
+  }
+
+  std::ifstream in(resume_file, std::ios::binary);
+  if(!in)
+    throw system_exceptiont("failed to open checkpoint `" + resume_file + "'");
+
+  const std::vector<path_decisionst> paths = read_path_checkpoint(in);
+  log.status() << "Resuming " << paths.size() << " paths from checkpoint "
+               << resume_file << messaget::eom;
+
+  symex.initialize_path_storage_from_checkpoint(
+    goto_symext::get_goto_function(goto_model), symex_symbol_table, paths);
+}
+
+void single_path_symex_only_checkert::write_checkpoint()
+{
+  const std::string file_name = options.get_option("paths-checkpoint");
+  if(file_name.empty())
+    return;
+
+  if(write_path_checkpoint(file_name, *worklist))
+  {
+    log.warning() << "failed to write checkpoint `" << file_name << "'"
+                  << messaget::eom;
+  }
 }
 
 bool single_path_symex_only_checkert::has_finished_exploration(
@@ -98,6 +141,7 @@ bool single_path_symex_only_checkert::resume_path(path_storaget::patht &path)
     symex_symbol_table);
   postprocess_equation(symex, path.equation, options, ns, ui_message_handler);
 
+  symex_profile.merge(symex.get_symex_profile());
   equation_output(symex, path.equation);
 
   return is_ready_to_decide(symex, path);
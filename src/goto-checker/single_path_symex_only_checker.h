@@ -13,6 +13,7 @@ Author: Daniel Kroening, Peter Schrammel
 #define CPROVER_GOTO_CHECKER_SINGLE_PATH_SYMEX_ONLY_CHECKER_H
 
 #include "incremental_goto_checker.h"
+#include "symex_profile.h"
 
 #include <goto-symex/path_storage.h>
 
@@ -37,6 +38,8 @@ protected:
   namespacet ns;
   guard_managert guard_manager;
   std::unique_ptr<path_storaget> worklist;
+  /// Profile accumulated over all paths if `--symex-profile` is set
+  symex_profilet symex_profile;
 
   void equation_output(
     const symex_bmct &symex,
@@ -44,9 +47,14 @@ protected:
 
   virtual void setup_symex(symex_bmct &symex);
 
-  /// Adds the initial goto-symex state as a path to the worklist
+  /// Adds the initial goto-symex state as a path to the worklist, or, if
+  /// `--paths-resume` is set, the paths stored in the given checkpoint
   virtual void initialize_worklist();
 
+  /// Writes the paths in the worklist to the file given by
+  /// `--paths-checkpoint`, if set
+  void write_checkpoint();
+
   /// Continues exploring the given \p path using goto-symex
   /// \return whether the path is ready to be checked
   virtual bool resume_path(path_storaget::patht &path);
@@ -13,6 +13,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <goto-symex/symex_target_equation.h>
 
+#include <chrono>
 #include <limits>
 
 #include <util/simplify_expr.h>
@@ -33,6 +34,7 @@ symex_bmct::symex_bmct(
       path_storage,
       guard_manager),
     record_coverage(!options.get_option("symex-coverage-report").empty()),
+    record_profile(options.get_bool_option("symex-profile")),
     havoc_bodyless_functions(
       options.get_bool_option("havoc-undefined-functions")),
     symex_coverage(ns)
@@ -72,7 +74,22 @@ void symex_bmct::symex_step(
     log.statistics() << log.eom;
   }
 
-  goto_symext::symex_step(get_goto_function, state);
+  if(record_profile)
+  {
+    const irep_idt function_id = state.source.function_id;
+    const std::size_t ssa_steps = target.SSA_steps.size();
+    const auto step_start = std::chrono::steady_clock::now();
+
+    goto_symext::symex_step(get_goto_function, state);
+
+    symex_profile.record_step(
+      function_id,
+      cur_pc,
+      std::chrono::steady_clock::now() - step_start,
+      target.SSA_steps.size() - ssa_steps);
+  }
+  else
+    goto_symext::symex_step(get_goto_function, state);
 
   if(
     record_coverage &&
@@ -105,6 +122,9 @@ void symex_bmct::merge_goto(
 
   goto_symext::merge_goto(prev_source, std::move(goto_state), state);
 
+  if(record_profile)
+    symex_profile.record_merge(state.source.function_id, state.source.pc);
+
   PRECONDITION(prev_pc->is_goto());
   if(
     record_coverage &&
@@ -21,6 +21,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <goto-instrument/unwindset.h>
 
 #include "symex_coverage.h"
+#include "symex_profile.h"
 
 class symex_bmct : public goto_symext
 {
@@ -80,7 +81,13 @@ public:
     return symex_coverage.generate_report(goto_functions, path);
   }
 
+  const symex_profilet &get_symex_profile() const
+  {
+    return symex_profile;
+  }
+
   const bool record_coverage;
+  const bool record_profile;
   const bool havoc_bodyless_functions;
 
   unwindsett unwindset;
@@ -116,6 +123,7 @@ protected:
   std::unordered_set<irep_idt> body_warnings;
 
   symex_coveraget symex_coverage;
+  symex_profilet symex_profile;
 };
 
 #endif // CPROVER_GOTO_CHECKER_SYMEX_BMC_H
@@ -0,0 +1,129 @@
+/*******************************************************************\
+
+Module: Bounded Model Checking with a Global Unwinding Bound
+
+Author: Daniel Kroening, Peter Schrammel
+
+\*******************************************************************/
+
+/// \file
+/// Bounded Model Checking with a global unwinding bound that is raised
+/// incrementally for all loops
+
+#include "symex_bmc_incremental_unwind.h"
+
+#include <limits>
+
+#include <util/expr_util.h>
+#include <util/make_unique.h>
+
+symex_bmc_incremental_unwindt::symex_bmc_incremental_unwindt(
+  message_handlert &message_handler,
+  const symbol_tablet &outer_symbol_table,
+  symex_target_equationt &target,
+  const optionst &options,
+  path_storaget &path_storage,
+  guard_managert &guard_manager)
+  : symex_bmct(
+      message_handler,
+      outer_symbol_table,
+      target,
+      options,
+      path_storage,
+      guard_manager),
+    unwind_bound(
+      options.is_set("unwind-min")
+        ? options.get_unsigned_int_option("unwind-min")
+        : 1),
+    max_unwind(
+      options.is_set("unwind-max")
+        ? options.get_unsigned_int_option("unwind-max")
+        : std::numeric_limits<unsigned>::max())
+{
+}
+
+bool symex_bmc_incremental_unwindt::from_entry_point_of(
+  const get_goto_functiont &get_goto_function,
+  symbol_tablet &new_symbol_table)
+{
+  symex_from_entry_point_of(get_goto_function, new_symbol_table);
+
+  return !saved_states.empty();
+}
+
+bool symex_bmc_incremental_unwindt::resume(
+  const get_goto_functiont &get_goto_function,
+  symbol_tablet &new_symbol_table)
+{
+  PRECONDITION(!saved_states.empty());
+
+  ++unwind_bound;
+
+  std::vector<std::unique_ptr<statet>> states;
+  states.swap(saved_states);
+
+  for(auto &state : states)
+  {
+    symbol_tablet state_symbol_table;
+    symex_with_state(*state, get_goto_function, state_symbol_table);
+
+    // the names minted on the resumed path are needed for error traces
+    for(const auto &symbol_pair : state_symbol_table.symbols)
+      new_symbol_table.insert(symbol_pair.second);
+
+    state = nullptr;
+  }
+
+  return !saved_states.empty();
+}
+
+bool symex_bmc_incremental_unwindt::should_stop_unwind(
+  const symex_targett::sourcet &source,
+  const call_stackt &context,
+  unsigned unwind)
+{
+  soft_cut = false;
+
+  // --unwind, --unwindset and the unwind handlers take precedence
+  if(symex_bmct::should_stop_unwind(source, context, unwind))
+    return true;
+
+  if(unwind < unwind_bound)
+    return false;
+
+  soft_cut = unwind_bound < max_unwind;
+
+  log.statistics() << (soft_cut ? "Pausing" : "Not unwinding") << " loop "
+                   << goto_programt::loop_id(source.function_id, *source.pc)
+                   << " iteration " << unwind << " (bound " << unwind_bound
+                   << ")" << log.eom;
+
+  return true;
+}
+
+void symex_bmc_incremental_unwindt::loop_bound_exceeded(
+  statet &state,
+  const exprt &guard)
+{
+  if(!soft_cut)
+  {
+    symex_bmct::loop_bound_exceeded(state, guard);
+    return;
+  }
+
+  // Save the paths that take the back edge, to be resumed at the loop head
+  // once the bound has been raised. The paths waiting at merge points are
+  // continued by the current state, hence the saved state does not get them.
+  auto saved_state = util_make_unique<statet>(state, &target);
+  saved_state->guard.add(guard);
+  for(auto &frame : saved_state->call_stack())
+    frame.goto_state_map.clear();
+  symex_transition(*saved_state, state.source.pc->get_target(), true);
+  saved_states.push_back(std::move(saved_state));
+
+  // Continue with the paths that leave the loop, without assuming that no
+  // path takes the back edge.
+  state.guard.add(boolean_negate(guard));
+  if(state.guard.is_false())
+    state.reachable = false;
+}
@@ -0,0 +1,77 @@
+/*******************************************************************\
+
+Module: Bounded Model Checking with a Global Unwinding Bound
+
+Author: Daniel Kroening, Peter Schrammel
+
+\*******************************************************************/
+
+/// \file
+/// Bounded Model Checking with a global unwinding bound that is raised
+/// incrementally for all loops
+
+#ifndef CPROVER_GOTO_CHECKER_SYMEX_BMC_INCREMENTAL_UNWIND_H
+#define CPROVER_GOTO_CHECKER_SYMEX_BMC_INCREMENTAL_UNWIND_H
+
+#include "symex_bmc.h"
+
+#include <memory>
+#include <vector>
+
+/// Symbolic execution that unwinds every loop up to a global bound. The paths
+/// that would unwind a loop further are not cut: their state is saved at the
+/// loop head, and symbolic execution continues with the paths that leave the
+/// loop. Raising the bound resumes the saved states, which extends the same
+/// equation. Limits given by `--unwind`, `--unwindset` or the loop unwind
+/// handlers are hard caps with the usual semantics, e.g. unwinding assertions,
+/// and so is the global bound once it has reached `--unwind-max`.
+class symex_bmc_incremental_unwindt : public symex_bmct
+{
+public:
+  symex_bmc_incremental_unwindt(
+    message_handlert &,
+    const symbol_tablet &outer_symbol_table,
+    symex_target_equationt &,
+    const optionst &,
+    path_storaget &,
+    guard_managert &);
+
+  /// Run symbolic execution from the entry point with the initial bound
+  /// \return True if states have been saved, i.e. symex can be resumed
+  bool from_entry_point_of(
+    const get_goto_functiont &get_goto_function,
+    symbol_tablet &new_symbol_table);
+
+  /// Raise the bound by one and continue symbolic execution from all the
+  /// states saved so far. The symbols minted on the resumed paths are added
+  /// to \p new_symbol_table.
+  /// \return True if states have been saved again, i.e. symex can be resumed
+  bool resume(
+    const get_goto_functiont &get_goto_function,
+    symbol_tablet &new_symbol_table);
+
+  unsigned get_unwind_bound() const
+  {
+    return unwind_bound;
+  }
+
+protected:
+  unsigned unwind_bound;
+  const unsigned max_unwind;
+
+  /// States of the paths that have been paused at a loop head
+  std::vector<std::unique_ptr<statet>> saved_states;
+
+  /// Whether the loop that is being left reached the global bound, rather
+  /// than a hard cap
+  bool soft_cut = false;
+
+  bool should_stop_unwind(
+    const symex_targett::sourcet &source,
+    const call_stackt &context,
+    unsigned unwind) override;
+
+  void loop_bound_exceeded(statet &state, const exprt &guard) override;
+};
+
+#endif // CPROVER_GOTO_CHECKER_SYMEX_BMC_INCREMENTAL_UNWIND_H
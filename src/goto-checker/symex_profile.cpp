@@ -0,0 +1,198 @@
+/*******************************************************************\
+
+Module: Record and print a profile of symbolic execution
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Record and print a profile of symbolic execution
+
+#include "symex_profile.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#include <util/json.h>
+#include <util/ui_message.h>
+#include <util/xml.h>
+
+void symex_profilet::merge(const symex_profilet &other)
+{
+  for(const auto &entry : other.instructions)
+  {
+    instruction_recordt &instruction = instructions[entry.first];
+    instruction.function_id = entry.second.function_id;
+    instruction.record += entry.second.record;
+  }
+}
+
+typedef std::vector<std::pair<std::string, symex_profilet::recordt>>
+  profile_entriest;
+
+/// \return the entries of \p records, most expensive first
+static profile_entriest
+sort_by_time(const std::map<std::string, symex_profilet::recordt> &records)
+{
+  profile_entriest entries(records.begin(), records.end());
+  std::stable_sort(
+    entries.begin(),
+    entries.end(),
+    [](
+      const profile_entriest::value_type &a,
+      const profile_entriest::value_type &b) {
+      return a.second.time > b.second.time;
+    });
+  return entries;
+}
+
+static void output_text(
+  messaget &log,
+  const std::string &title,
+  const profile_entriest &entries,
+  std::chrono::duration<double> total_time)
+{
+  // the full list is available in the structured output formats
+  const std::size_t max_entries = 10;
+
+  log.status() << title << ":" << messaget::eom;
+  for(std::size_t i = 0; i < entries.size() && i < max_entries; ++i)
+  {
+    const symex_profilet::recordt &record = entries[i].second;
+    const double share = total_time.count() > 0
+                           ? 100 * record.time.count() / total_time.count()
+                           : 0;
+
+    // format separately so as not to change the flags of the message stream
+    std::ostringstream line;
+    line << "  " << std::fixed << std::setprecision(1) << std::setw(5) << share
+         << "% " << std::setprecision(3) << std::setw(9) << record.time.count()
+         << "s  visits " << record.visits << "  SSA steps " << record.ssa_steps
+         << "  merges " << record.merges << "  " << entries[i].first;
+    log.status() << line.str() << messaget::eom;
+  }
+}
+
+static json_arrayt to_json(const profile_entriest &entries)
+{
+  json_arrayt json_entries;
+  for(const auto &entry : entries)
+  {
+    json_entries.push_back(json_objectt{
+      {"name", json_stringt(entry.first)},
+      {"time", json_numbert(std::to_string(entry.second.time.count()))},
+      {"visits", json_numbert(std::to_string(entry.second.visits))},
+      {"ssaSteps", json_numbert(std::to_string(entry.second.ssa_steps))},
+      {"merges", json_numbert(std::to_string(entry.second.merges))}});
+  }
+  return json_entries;
+}
+
+static void
+to_xml(const std::string &name, const profile_entriest &entries, xmlt &xml)
+{
+  for(const auto &entry : entries)
+  {
+    xmlt &xml_entry = xml.new_element(name);
+    xml_entry.set_attribute("name", entry.first);
+    xml_entry.set_attribute("time", std::to_string(entry.second.time.count()));
+    xml_entry.set_attribute("visits", std::to_string(entry.second.visits));
+    xml_entry.set_attribute(
+      "ssa-steps", std::to_string(entry.second.ssa_steps));
+    xml_entry.set_attribute("merges", std::to_string(entry.second.merges));
+  }
+}
+
+void symex_profilet::output(ui_message_handlert &ui_message_handler) const
+{
+  std::map<std::string, recordt> functions;
+  std::map<std::string, recordt> loops;
+  std::map<std::string, recordt> source_lines;
+  recordt total;
+
+  for(const auto &entry : instructions)
+  {
+    const goto_programt::const_targett pc = entry.first;
+    const irep_idt &function_id = entry.second.function_id;
+    const recordt &record = entry.second.record;
+
+    total += record;
+    functions[id2string(function_id)] += record;
+
+    const source_locationt &source_location = pc->source_location;
+    if(!source_location.get_file().empty())
+    {
+      source_lines
+        [id2string(source_location.get_file()) + ":" +
+         id2string(source_location.get_line())] += record;
+    }
+
+    // a loop consists of the instructions from the target of its backwards
+    // goto up to and including that goto
+    if(pc->is_backwards_goto())
+    {
+      recordt &loop =
+        loops[id2string(goto_programt::loop_id(function_id, *pc))];
+      for(auto it = pc->get_target();; ++it)
+      {
+        const auto body_entry = instructions.find(it);
+        if(body_entry != instructions.end())
+          loop += body_entry->second.record;
+        if(it == pc)
+          break;
+      }
+    }
+  }
+
+  const profile_entriest sorted_functions = sort_by_time(functions);
+  const profile_entriest sorted_loops = sort_by_time(loops);
+  const profile_entriest sorted_source_lines = sort_by_time(source_lines);
+
+  messaget log(ui_message_handler);
+
+  switch(ui_message_handler.get_ui())
+  {
+  case ui_message_handlert::uit::PLAIN:
+    log.status() << "Symex profile: " << total.time.count() << "s, "
+                 << total.visits << " instructions executed, "
+                 << total.ssa_steps << " SSA steps, " << total.merges
+                 << " merges" << messaget::eom;
+    output_text(log, "Functions", sorted_functions, total.time);
+    output_text(log, "Loops", sorted_loops, total.time);
+    output_text(log, "Source lines", sorted_source_lines, total.time);
+    break;
+
+  case ui_message_handlert::uit::XML_UI:
+  {
+    xmlt xml("symex-profile");
+    xml.set_attribute("time", std::to_string(total.time.count()));
+    xml.set_attribute("visits", std::to_string(total.visits));
+    xml.set_attribute("ssa-steps", std::to_string(total.ssa_steps));
+    xml.set_attribute("merges", std::to_string(total.merges));
+    to_xml("function", sorted_functions, xml);
+    to_xml("loop", sorted_loops, xml);
+    to_xml("source-line", sorted_source_lines, xml);
+    log.status() << xml;
+  }
+  break;
+
+  case ui_message_handlert::uit::JSON_UI:
+  {
+    json_objectt json_profile{
+      {"time", json_numbert(std::to_string(total.time.count()))},
+      {"visits", json_numbert(std::to_string(total.visits))},
+      {"ssaSteps", json_numbert(std::to_string(total.ssa_steps))},
+      {"merges", json_numbert(std::to_string(total.merges))},
+      {"functions", to_json(sorted_functions)},
+      {"loops", to_json(sorted_loops)},
+      {"sourceLines", to_json(sorted_source_lines)}};
+    json_objectt json_result;
+    json_result["symexProfile"] = std::move(json_profile);
+    log.status() << json_result;
+  }
+  break;
+  }
+}
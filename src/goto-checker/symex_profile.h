@@ -0,0 +1,86 @@
+/*******************************************************************\
+
+Module: Record and print a profile of symbolic execution
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Record and print a profile of symbolic execution
+
+#ifndef CPROVER_GOTO_CHECKER_SYMEX_PROFILE_H
+#define CPROVER_GOTO_CHECKER_SYMEX_PROFILE_H
+
+#include <chrono>
+#include <map>
+
+#include <goto-programs/goto_program.h>
+
+class ui_message_handlert;
+
+/// Records, per instruction, how often symbolic execution visited it, how long
+/// executing it took, how many SSA steps it produced and how many states were
+/// merged into it. The report aggregates these by function, by loop and by
+/// source line, so that expensive parts of the program can be identified.
+class symex_profilet
+{
+public:
+  struct recordt
+  {
+    std::size_t visits = 0;
+    std::size_t ssa_steps = 0;
+    std::size_t merges = 0;
+    std::chrono::duration<double> time = std::chrono::duration<double>(0);
+
+    recordt &operator+=(const recordt &other)
+    {
+      visits += other.visits;
+      ssa_steps += other.ssa_steps;
+      merges += other.merges;
+      time += other.time;
+      return *this;
+    }
+  };
+
+  /// Record one execution of the instruction \p pc of function \p function_id
+  void record_step(
+    const irep_idt &function_id,
+    goto_programt::const_targett pc,
+    std::chrono::duration<double> time,
+    std::size_t ssa_steps)
+  {
+    instruction_recordt &entry = instructions[pc];
+    entry.function_id = function_id;
+    ++entry.record.visits;
+    entry.record.time += time;
+    entry.record.ssa_steps += ssa_steps;
+  }
+
+  /// Record that a state was merged into the one at \p pc of function
+  /// \p function_id
+  void
+  record_merge(const irep_idt &function_id, goto_programt::const_targett pc)
+  {
+    instruction_recordt &entry = instructions[pc];
+    entry.function_id = function_id;
+    ++entry.record.merges;
+  }
+
+  /// Add the records of \p other to this profile
+  void merge(const symex_profilet &other);
+
+  /// Output the aggregated profile, sorted by time spent
+  void output(ui_message_handlert &ui_message_handler) const;
+
+protected:
+  struct instruction_recordt
+  {
+    irep_idt function_id;
+    recordt record;
+  };
+
+  std::map<goto_programt::const_targett, instruction_recordt> instructions;
+};
+
+#endif // CPROVER_GOTO_CHECKER_SYMEX_PROFILE_H
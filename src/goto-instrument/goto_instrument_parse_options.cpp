@@ -1891,6 +1891,7 @@ void goto_instrument_parse_optionst::help()
     " --xml-ui                     use XML-formatted output\n"
     " --json-ui                    use JSON-formatted output\n"
     HELP_TIMESTAMP
+    HELP_METRICS
     "\n";
   // clang-format on
 }
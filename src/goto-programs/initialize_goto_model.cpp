@@ -16,6 +16,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <util/config.h>
 #include <util/message.h>
+#include <util/metrics.h>
 #include <util/object_factory_parameters.h>
 #include <util/options.h>
 #include <util/unicode.h>
@@ -61,6 +62,8 @@ goto_modelt initialize_goto_model(
   message_handlert &message_handler,
   const optionst &options)
 {
+  scoped_metrics_timert timer("loadProgram");
+
   messaget msg(message_handler);
   if(files.empty())
   {
@@ -14,9 +14,11 @@ Author: Daniel Kroening
 #include "xml_goto_trace.h"
 
 #include <cassert>
+#include <functional>
 
 #include <util/symbol.h>
 #include <util/xml_irep.h>
+#include <util/xml_stream.h>
 
 #include <langapi/language_util.h>
 #include <util/arith_tools.h>
@@ -55,213 +57,260 @@ xmlt full_lhs_value(const goto_trace_stept &step, const namespacet &ns)
   return value_xml;
 }
 
-void convert(
+/// Convert a single trace step
+/// \param ns: namespace
+/// \param step: the step to convert
+/// \param previous_source_location: the last source location shown before
+///   \p step
+/// \return the XML representation of \p step, or an element without name if
+///   the step is not shown
+static xmlt convert(
   const namespacet &ns,
-  const goto_tracet &goto_trace,
-  xmlt &dest)
+  const goto_trace_stept &step,
+  const source_locationt &previous_source_location)
 {
-  dest=xmlt("goto_trace");
+  const source_locationt &source_location = step.pc->source_location;
 
-  source_locationt previous_source_location;
+  xmlt xml_location;
+  if(source_location.is_not_nil() && !source_location.get_file().empty())
+    xml_location = xml(source_location);
 
-  for(const auto &step : goto_trace.steps)
+  switch(step.type)
   {
-    const source_locationt &source_location=step.pc->source_location;
+  case goto_trace_stept::typet::ASSERT:
+    if(!step.cond_value)
+    {
+      xmlt xml_failure("failure");
 
-    xmlt xml_location;
-    if(source_location.is_not_nil() && !source_location.get_file().empty())
-      xml_location=xml(source_location);
+      xml_failure.set_attribute_bool("hidden", step.hidden);
+      xml_failure.set_attribute("thread", std::to_string(step.thread_nr));
+      xml_failure.set_attribute("step_nr", std::to_string(step.step_nr));
+      xml_failure.set_attribute("reason", id2string(step.comment));
+      xml_failure.set_attribute("property", id2string(step.property_id));
 
-    switch(step.type)
-    {
-    case goto_trace_stept::typet::ASSERT:
-      if(!step.cond_value)
-      {
-        xmlt &xml_failure=dest.new_element("failure");
+      if(!xml_location.name.empty())
+        xml_failure.new_element().swap(xml_location);
 
-        xml_failure.set_attribute_bool("hidden", step.hidden);
-        xml_failure.set_attribute("thread", std::to_string(step.thread_nr));
-        xml_failure.set_attribute("step_nr", std::to_string(step.step_nr));
-        xml_failure.set_attribute("reason", id2string(step.comment));
-        xml_failure.set_attribute("property", id2string(step.property_id));
+      return xml_failure;
+    }
+    break;
 
-        if(!xml_location.name.empty())
-          xml_failure.new_element().swap(xml_location);
-      }
-      break;
+  case goto_trace_stept::typet::ASSIGNMENT:
+  case goto_trace_stept::typet::DECL:
+  {
+    auto lhs_object = step.get_lhs_object();
+    irep_idt identifier =
+      lhs_object.has_value() ? lhs_object->get_identifier() : irep_idt();
+    xmlt xml_assignment("assignment");
 
-    case goto_trace_stept::typet::ASSIGNMENT:
-    case goto_trace_stept::typet::DECL:
-    {
-      auto lhs_object = step.get_lhs_object();
-      irep_idt identifier =
-        lhs_object.has_value() ? lhs_object->get_identifier() : irep_idt();
-      xmlt &xml_assignment = dest.new_element("assignment");
+    if(!xml_location.name.empty())
+      xml_assignment.new_element().swap(xml_location);
 
-      if(!xml_location.name.empty())
-        xml_assignment.new_element().swap(xml_location);
+    {
+      const symbolt *symbol;
 
+      if(
+        lhs_object.has_value() &&
+        !ns.lookup(lhs_object->get_identifier(), symbol))
       {
-        const symbolt *symbol;
-
-        if(
-          lhs_object.has_value() &&
-          !ns.lookup(lhs_object->get_identifier(), symbol))
-        {
-          std::string type_string = from_type(ns, symbol->name, symbol->type);
-
-          xml_assignment.set_attribute("mode", id2string(symbol->mode));
-          xml_assignment.set_attribute("identifier", id2string(symbol->name));
-          xml_assignment.set_attribute(
-            "base_name", id2string(symbol->base_name));
-          xml_assignment.set_attribute(
-            "display_name", id2string(symbol->display_name()));
-          xml_assignment.new_element("type").data = type_string;
-        }
+        std::string type_string = from_type(ns, symbol->name, symbol->type);
+
+        xml_assignment.set_attribute("mode", id2string(symbol->mode));
+        xml_assignment.set_attribute("identifier", id2string(symbol->name));
+        xml_assignment.set_attribute(
+          "base_name", id2string(symbol->base_name));
+        xml_assignment.set_attribute(
+          "display_name", id2string(symbol->display_name()));
+        xml_assignment.new_element("type").data = type_string;
       }
+    }
 
-      std::string full_lhs_string;
-
-      if(step.full_lhs.is_not_nil())
-        full_lhs_string = from_expr(ns, identifier, step.full_lhs);
+    std::string full_lhs_string;
 
-      xml_assignment.new_element("full_lhs").data = full_lhs_string;
-      xml_assignment.new_element(full_lhs_value(step, ns));
+    if(step.full_lhs.is_not_nil())
+      full_lhs_string = from_expr(ns, identifier, step.full_lhs);
 
-      xml_assignment.set_attribute_bool("hidden", step.hidden);
-      xml_assignment.set_attribute("thread", std::to_string(step.thread_nr));
-      xml_assignment.set_attribute("step_nr", std::to_string(step.step_nr));
+    xml_assignment.new_element("full_lhs").data = full_lhs_string;
+    xml_assignment.new_element(full_lhs_value(step, ns));
 
-      xml_assignment.set_attribute(
-        "assignment_type",
-        step.assignment_type ==
-            goto_trace_stept::assignment_typet::ACTUAL_PARAMETER
-          ? "actual_parameter"
-          : "state");
-      break;
-    }
+    xml_assignment.set_attribute_bool("hidden", step.hidden);
+    xml_assignment.set_attribute("thread", std::to_string(step.thread_nr));
+    xml_assignment.set_attribute("step_nr", std::to_string(step.step_nr));
 
-    case goto_trace_stept::typet::OUTPUT:
-    {
-      printf_formattert printf_formatter(ns);
-      printf_formatter(id2string(step.format_string), step.io_args);
-      std::string text = printf_formatter.as_string();
-      xmlt &xml_output = dest.new_element("output");
+    xml_assignment.set_attribute(
+      "assignment_type",
+      step.assignment_type ==
+          goto_trace_stept::assignment_typet::ACTUAL_PARAMETER
+        ? "actual_parameter"
+        : "state");
+    return xml_assignment;
+  }
 
-      xml_output.new_element("text").data = text;
+  case goto_trace_stept::typet::OUTPUT:
+  {
+    printf_formattert printf_formatter(ns);
+    printf_formatter(id2string(step.format_string), step.io_args);
+    std::string text = printf_formatter.as_string();
+    xmlt xml_output("output");
 
-      xml_output.set_attribute_bool("hidden", step.hidden);
-      xml_output.set_attribute("thread", std::to_string(step.thread_nr));
-      xml_output.set_attribute("step_nr", std::to_string(step.step_nr));
+    xml_output.new_element("text").data = text;
 
-      if(!xml_location.name.empty())
-        xml_output.new_element().swap(xml_location);
+    xml_output.set_attribute_bool("hidden", step.hidden);
+    xml_output.set_attribute("thread", std::to_string(step.thread_nr));
+    xml_output.set_attribute("step_nr", std::to_string(step.step_nr));
 
-      for(const auto &arg : step.io_args)
-      {
-        xml_output.new_element("value").data =
-          from_expr(ns, step.function_id, arg);
-        xml_output.new_element("value_expression").new_element(xml(arg, ns));
-      }
-      break;
-    }
+    if(!xml_location.name.empty())
+      xml_output.new_element().swap(xml_location);
 
-    case goto_trace_stept::typet::INPUT:
+    for(const auto &arg : step.io_args)
     {
-      xmlt &xml_input = dest.new_element("input");
-      xml_input.new_element("input_id").data = id2string(step.io_id);
-
-      xml_input.set_attribute_bool("hidden", step.hidden);
-      xml_input.set_attribute("thread", std::to_string(step.thread_nr));
-      xml_input.set_attribute("step_nr", std::to_string(step.step_nr));
+      xml_output.new_element("value").data =
+        from_expr(ns, step.function_id, arg);
+      xml_output.new_element("value_expression").new_element(xml(arg, ns));
+    }
+    return xml_output;
+  }
 
-      for(const auto &arg : step.io_args)
-      {
-        xml_input.new_element("value").data =
-          from_expr(ns, step.function_id, arg);
-        xml_input.new_element("value_expression").new_element(xml(arg, ns));
-      }
+  case goto_trace_stept::typet::INPUT:
+  {
+    xmlt xml_input("input");
+    xml_input.new_element("input_id").data = id2string(step.io_id);
 
-      if(!xml_location.name.empty())
-        xml_input.new_element().swap(xml_location);
-      break;
-    }
+    xml_input.set_attribute_bool("hidden", step.hidden);
+    xml_input.set_attribute("thread", std::to_string(step.thread_nr));
+    xml_input.set_attribute("step_nr", std::to_string(step.step_nr));
 
-    case goto_trace_stept::typet::FUNCTION_CALL:
+    for(const auto &arg : step.io_args)
     {
-      std::string tag = "function_call";
-      xmlt &xml_call_return = dest.new_element(tag);
+      xml_input.new_element("value").data =
+        from_expr(ns, step.function_id, arg);
+      xml_input.new_element("value_expression").new_element(xml(arg, ns));
+    }
 
-      xml_call_return.set_attribute_bool("hidden", step.hidden);
-      xml_call_return.set_attribute("thread", std::to_string(step.thread_nr));
-      xml_call_return.set_attribute("step_nr", std::to_string(step.step_nr));
+    if(!xml_location.name.empty())
+      xml_input.new_element().swap(xml_location);
+    return xml_input;
+  }
 
-      const symbolt &symbol = ns.lookup(step.called_function);
-      xmlt &xml_function = xml_call_return.new_element("function");
-      xml_function.set_attribute(
-        "display_name", id2string(symbol.display_name()));
-      xml_function.set_attribute("identifier", id2string(symbol.name));
-      xml_function.new_element() = xml(symbol.location);
+  case goto_trace_stept::typet::FUNCTION_CALL:
+  {
+    std::string tag = "function_call";
+    xmlt xml_call_return(tag);
+
+    xml_call_return.set_attribute_bool("hidden", step.hidden);
+    xml_call_return.set_attribute("thread", std::to_string(step.thread_nr));
+    xml_call_return.set_attribute("step_nr", std::to_string(step.step_nr));
+
+    const symbolt &symbol = ns.lookup(step.called_function);
+    xmlt &xml_function = xml_call_return.new_element("function");
+    xml_function.set_attribute(
+      "display_name", id2string(symbol.display_name()));
+    xml_function.set_attribute("identifier", id2string(symbol.name));
+    xml_function.new_element() = xml(symbol.location);
+
+    if(!xml_location.name.empty())
+      xml_call_return.new_element().swap(xml_location);
+    return xml_call_return;
+  }
 
-      if(!xml_location.name.empty())
-        xml_call_return.new_element().swap(xml_location);
-      break;
-    }
+  case goto_trace_stept::typet::FUNCTION_RETURN:
+  {
+    std::string tag = "function_return";
+    xmlt xml_call_return(tag);
+
+    xml_call_return.set_attribute_bool("hidden", step.hidden);
+    xml_call_return.set_attribute("thread", std::to_string(step.thread_nr));
+    xml_call_return.set_attribute("step_nr", std::to_string(step.step_nr));
+
+    const symbolt &symbol = ns.lookup(step.called_function);
+    xmlt &xml_function = xml_call_return.new_element("function");
+    xml_function.set_attribute(
+      "display_name", id2string(symbol.display_name()));
+    xml_function.set_attribute("identifier", id2string(symbol.name));
+    xml_function.new_element() = xml(symbol.location);
+
+    if(!xml_location.name.empty())
+      xml_call_return.new_element().swap(xml_location);
+    return xml_call_return;
+  }
 
-    case goto_trace_stept::typet::FUNCTION_RETURN:
+  case goto_trace_stept::typet::ATOMIC_BEGIN:
+  case goto_trace_stept::typet::ATOMIC_END:
+  case goto_trace_stept::typet::MEMORY_BARRIER:
+  case goto_trace_stept::typet::SPAWN:
+  case goto_trace_stept::typet::SHARED_WRITE:
+  case goto_trace_stept::typet::SHARED_READ:
+  case goto_trace_stept::typet::CONSTRAINT:
+  case goto_trace_stept::typet::DEAD:
+  case goto_trace_stept::typet::LOCATION:
+  case goto_trace_stept::typet::GOTO:
+  case goto_trace_stept::typet::ASSUME:
+  case goto_trace_stept::typet::NONE:
+  {
+    const auto default_step = ::default_step(step, previous_source_location);
+    if(default_step)
     {
-      std::string tag = "function_return";
-      xmlt &xml_call_return = dest.new_element(tag);
+      xmlt xml_location_only(default_step_name(default_step->kind));
 
-      xml_call_return.set_attribute_bool("hidden", step.hidden);
-      xml_call_return.set_attribute("thread", std::to_string(step.thread_nr));
-      xml_call_return.set_attribute("step_nr", std::to_string(step.step_nr));
+      xml_location_only.set_attribute_bool("hidden", default_step->hidden);
+      xml_location_only.set_attribute(
+        "thread", std::to_string(default_step->thread_number));
+      xml_location_only.set_attribute(
+        "step_nr", std::to_string(default_step->step_number));
 
-      const symbolt &symbol = ns.lookup(step.called_function);
-      xmlt &xml_function = xml_call_return.new_element("function");
-      xml_function.set_attribute(
-        "display_name", id2string(symbol.display_name()));
-      xml_function.set_attribute("identifier", id2string(symbol.name));
-      xml_function.new_element() = xml(symbol.location);
+      xml_location_only.new_element(xml(default_step->location));
 
-      if(!xml_location.name.empty())
-        xml_call_return.new_element().swap(xml_location);
-      break;
+      return xml_location_only;
     }
 
-    case goto_trace_stept::typet::ATOMIC_BEGIN:
-    case goto_trace_stept::typet::ATOMIC_END:
-    case goto_trace_stept::typet::MEMORY_BARRIER:
-    case goto_trace_stept::typet::SPAWN:
-    case goto_trace_stept::typet::SHARED_WRITE:
-    case goto_trace_stept::typet::SHARED_READ:
-    case goto_trace_stept::typet::CONSTRAINT:
-    case goto_trace_stept::typet::DEAD:
-    case goto_trace_stept::typet::LOCATION:
-    case goto_trace_stept::typet::GOTO:
-    case goto_trace_stept::typet::ASSUME:
-    case goto_trace_stept::typet::NONE:
-    {
-      const auto default_step = ::default_step(step, previous_source_location);
-      if(default_step)
-      {
-        xmlt &xml_location_only =
-          dest.new_element(default_step_name(default_step->kind));
+    break;
+  }
+  }
 
-        xml_location_only.set_attribute_bool("hidden", default_step->hidden);
-        xml_location_only.set_attribute(
-          "thread", std::to_string(default_step->thread_number));
-        xml_location_only.set_attribute(
-          "step_nr", std::to_string(default_step->step_number));
+  return xmlt();
+}
 
-        xml_location_only.new_element(xml(default_step->location));
-      }
+/// Convert all steps of \p goto_trace, passing the non-empty ones to
+/// \p output_step
+static void convert_steps(
+  const namespacet &ns,
+  const goto_tracet &goto_trace,
+  const std::function<void(xmlt &)> &output_step)
+{
+  source_locationt previous_source_location;
 
-      break;
-    }
-    }
+  for(const auto &step : goto_trace.steps)
+  {
+    xmlt xml_step = convert(ns, step, previous_source_location);
+    if(!xml_step.name.empty())
+      output_step(xml_step);
 
+    const source_locationt &source_location = step.pc->source_location;
     if(source_location.is_not_nil() && !source_location.get_file().empty())
-      previous_source_location=source_location;
+      previous_source_location = source_location;
   }
 }
+
+void convert(
+  const namespacet &ns,
+  const goto_tracet &goto_trace,
+  xmlt &dest)
+{
+  dest=xmlt("goto_trace");
+
+  convert_steps(ns, goto_trace, [&dest](xmlt &xml_step) {
+    dest.new_element().swap(xml_step);
+  });
+}
+
+void convert(
+  const namespacet &ns,
+  const goto_tracet &goto_trace,
+  xml_streamt &dest)
+{
+  xml_streamt &xml_trace = dest.push_back_stream("goto_trace");
+
+  convert_steps(ns, goto_trace, [&xml_trace](const xmlt &xml_step) {
+    xml_trace.push_back(xml_step);
+  });
+}
@@ -18,9 +18,18 @@ Date: November 2005
 
 #include "goto_trace.h"
 
+class xml_streamt;
+
 void convert(
   const namespacet &ns,
   const goto_tracet &goto_trace,
   xmlt &xml);
 
+/// Stream \p goto_trace as a new `goto_trace` child element of \p dest
+/// without building the whole trace in memory
+void convert(
+  const namespacet &ns,
+  const goto_tracet &goto_trace,
+  xml_streamt &dest);
+
 #endif // CPROVER_GOTO_PROGRAMS_XML_GOTO_TRACE_H
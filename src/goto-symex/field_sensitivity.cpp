@@ -13,11 +13,23 @@ Author: Michael Tautschnig
 #include <util/simplify_expr.h>
 #include <util/std_expr.h>
 
+#include <goto-programs/goto_program.h>
+
 #include "goto_symex_state.h"
 #include "symex_target.h"
 
 #define ENABLE_ARRAY_FIELD_SENSITIVITY
 
+/// \return true if \p expr is the expansion of a sparsely represented array,
+///   see \ref field_sensitivityt::get_sparse_fields
+static bool is_sparse_fields(const exprt &expr)
+{
+  const exprt *residual = &expr;
+  while(residual->id() == ID_with)
+    residual = &to_with_expr(*residual).old();
+  return residual != &expr && residual->get_bool(ID_C_sparse_array_residual);
+}
+
 exprt field_sensitivityt::apply(
   const namespacet &ns,
   goto_symex_statet &state,
@@ -35,6 +47,10 @@ exprt field_sensitivityt::apply(
 
   if(expr.id() == ID_symbol && expr.get_bool(ID_C_SSA_symbol) && !write)
   {
+    // the residual of a sparse array is part of an expansion already
+    if(expr.get_bool(ID_C_sparse_array_residual))
+      return expr;
+
     return get_fields(ns, state, to_ssa_expr(expr));
   }
   else if(
@@ -46,7 +62,8 @@ exprt field_sensitivityt::apply(
 #ifdef ENABLE_ARRAY_FIELD_SENSITIVITY
   else if(
     !write && expr.id() == ID_index &&
-    to_index_expr(expr).array().id() == ID_array)
+    (to_index_expr(expr).array().id() == ID_array ||
+     is_sparse_fields(to_index_expr(expr).array())))
   {
     return simplify_expr(std::move(expr), ns);
   }
@@ -111,12 +128,24 @@ exprt field_sensitivityt::apply(
           l2_size = to_array_type(array_from_symbol_table->type).size();
       }
 
-      if(
+      const bool expand_all =
         l2_size.id() == ID_constant &&
         numeric_cast_v<mp_integer>(to_constant_expr(l2_size)) <=
-          max_field_sensitivity_array_size)
+          max_field_sensitivity_array_size;
+      const std::set<mp_integer> *sparse_indices =
+        expand_all ? nullptr : get_sparse_indices(tmp);
+
+      if(expand_all || sparse_indices != nullptr)
       {
-        if(l2_index.get().id() == ID_constant)
+        // elements of sparse arrays at indices that are not tracked are kept
+        // in the array itself
+        const bool is_tracked =
+          l2_index.get().id() == ID_constant &&
+          (expand_all ||
+           sparse_indices->count(numeric_cast_v<mp_integer>(
+             to_constant_expr(l2_index.get()))) != 0);
+
+        if(is_tracked)
         {
           // place the entire index expression, not just the array operand,
           // in an SSA expression
@@ -130,7 +159,7 @@ exprt field_sensitivityt::apply(
           else
             return std::move(tmp);
         }
-        else if(!write)
+        else if(!write && l2_index.get().id() != ID_constant)
         {
           // Expand the array and return `{array[0]; array[1]; ...}[index]`
           exprt expanded_array =
@@ -184,7 +213,12 @@ exprt field_sensitivityt::get_fields(
     const mp_integer mp_array_size = numeric_cast_v<mp_integer>(
       to_constant_expr(to_array_type(ssa_expr.type()).size()));
     if(mp_array_size < 0 || mp_array_size > max_field_sensitivity_array_size)
-      return ssa_expr;
+    {
+      const std::set<mp_integer> *sparse_indices = get_sparse_indices(ssa_expr);
+      if(sparse_indices == nullptr)
+        return ssa_expr;
+      return get_sparse_fields(ns, state, ssa_expr, *sparse_indices);
+    }
 
     const array_typet &type = to_array_type(ssa_expr.type());
     const std::size_t array_size = numeric_cast_v<std::size_t>(mp_array_size);
@@ -216,6 +250,98 @@ exprt field_sensitivityt::get_fields(
     return ssa_expr;
 }
 
+/// Compute `array with [index1 := array[[index1]]] with [index2 := …]` for
+/// the tracked \p indices of the sparsely represented array \p ssa_expr. The
+/// symbol `array` in there is marked as residual, so that it is not expanded
+/// again.
+exprt field_sensitivityt::get_sparse_fields(
+  const namespacet &ns,
+  goto_symex_statet &state,
+  const ssa_exprt &ssa_expr,
+  const std::set<mp_integer> &indices) const
+{
+  ssa_exprt residual = ssa_expr;
+  residual.set(ID_C_sparse_array_residual, true);
+  exprt result = std::move(residual);
+
+  const exprt &array = ssa_expr.get_original_expr();
+
+  for(const mp_integer &i : indices)
+  {
+    const exprt index_constant = from_integer(i, index_type());
+    const index_exprt index(array, index_constant);
+    ssa_exprt tmp = ssa_expr;
+    bool was_l2 = !tmp.get_level_2().empty();
+    tmp.remove_level_2();
+    tmp.set_expression(index);
+    exprt element = was_l2 ? state.rename(get_fields(ns, state, tmp), ns).get()
+                           : get_fields(ns, state, tmp);
+    result =
+      with_exprt(std::move(result), index_constant, std::move(element));
+  }
+
+  return result;
+}
+
+const std::set<mp_integer> *
+field_sensitivityt::get_sparse_indices(const ssa_exprt &array) const
+{
+  if(sparse_array_indices == nullptr)
+    return nullptr;
+
+  const auto entry = sparse_array_indices->find(
+    ssa_exprt{array.get_original_expr()}.get_identifier());
+  if(entry == sparse_array_indices->end())
+    return nullptr;
+
+  return &entry->second;
+}
+
+void field_sensitivityt::collect_sparse_array_indices(
+  const goto_programt &goto_program,
+  const namespacet &ns,
+  std::size_t max_array_size,
+  sparse_array_indicest &dest)
+{
+  for(const auto &instruction : goto_program.instructions)
+  {
+    instruction.apply([&](const exprt &expr) {
+      for(auto it = expr.depth_cbegin(); it != expr.depth_cend(); ++it)
+      {
+        if(it->id() != ID_index)
+          continue;
+
+        const index_exprt &index = to_index_expr(*it);
+        const array_typet *type =
+          type_try_dynamic_cast<array_typet>(index.array().type());
+        if(
+          type == nullptr || type->size().id() != ID_constant ||
+          !ssa_exprt::can_build_identifier(index.array()))
+        {
+          continue;
+        }
+
+        const auto array_size =
+          numeric_cast<mp_integer>(to_constant_expr(type->size()));
+        const auto index_value =
+          numeric_cast<mp_integer>(simplify_expr(index.index(), ns));
+        if(
+          !array_size.has_value() || *array_size <= max_array_size ||
+          !index_value.has_value() || *index_value < 0 ||
+          *index_value >= *array_size)
+        {
+          continue;
+        }
+
+        std::set<mp_integer> &indices =
+          dest[ssa_exprt{index.array()}.get_identifier()];
+        if(indices.size() < max_array_size)
+          indices.insert(*index_value);
+      }
+    });
+  }
+}
+
 void field_sensitivityt::field_assignments(
   const namespacet &ns,
   goto_symex_statet &state,
@@ -300,6 +426,25 @@ void field_sensitivityt::field_assignments_rec(
 #ifdef ENABLE_ARRAY_FIELD_SENSITIVITY
   else if(const auto &type = type_try_dynamic_cast<array_typet>(lhs.type()))
   {
+    if(lhs_fs.id() == ID_with)
+    {
+      // sparse array: assign to the tracked elements, the residual array is
+      // the innermost operand
+      const with_exprt &with_expr = to_with_expr(lhs_fs);
+      const index_exprt index_rhs(lhs, with_expr.where());
+
+      field_assignments_rec(
+        ns,
+        state,
+        with_expr.new_value(),
+        index_rhs,
+        target,
+        allow_pointer_unsoundness);
+      field_assignments_rec(
+        ns, state, with_expr.old(), lhs, target, allow_pointer_unsoundness);
+      return;
+    }
+
     const std::size_t array_size =
       numeric_cast_v<std::size_t>(to_constant_expr(type->size()));
     PRECONDITION(lhs_fs.operands().size() == array_size);
@@ -356,3 +501,13 @@ bool field_sensitivityt::is_divisible(const ssa_exprt &expr) const
 
   return false;
 }
+
+bool field_sensitivityt::is_sparse(const ssa_exprt &expr) const
+{
+#ifdef ENABLE_ARRAY_FIELD_SENSITIVITY
+  return expr.type().id() == ID_array && !is_divisible(expr) &&
+         get_sparse_indices(expr) != nullptr;
+#else
+  return false;
+#endif
+}
@@ -9,11 +9,18 @@ Author: Michael Tautschnig
 #ifndef CPROVER_GOTO_SYMEX_FIELD_SENSITIVITY_H
 #define CPROVER_GOTO_SYMEX_FIELD_SENSITIVITY_H
 
+#include <memory>
+#include <set>
+#include <unordered_map>
+
+#include <util/irep.h>
 #include <util/magic.h>
+#include <util/mp_arith.h>
 
 class exprt;
 class ssa_exprt;
 class namespacet;
+class goto_programt;
 class goto_symex_statet;
 class symex_targett;
 
@@ -65,6 +72,16 @@ class symex_targett;
 /// and arrays whose size exceed the bound \c max_field_sensitivity_array_size.
 /// See \ref field_sensitivityt::apply.
 ///
+/// ### Sparse arrays
+/// Arrays exceeding \c max_field_sensitivity_array_size can optionally be
+/// represented sparsely: only the elements at the constant indices listed in
+/// \ref field_sensitivityt::sparse_array_indicest get symbols `array[[index]]`,
+/// all other elements are kept in the symbol `array` itself, the residual.
+/// In an rvalue, `array` is then replaced by
+/// `array with [index1 := array[[index1]]] with [index2 := …]`, and an
+/// assignment to `array` is followed by assignments to the tracked elements,
+/// as for arrays that are expanded completely.
+///
 /// ### Symbols representing arrays
 /// In an rvalue, a symbol `array` which has array type will be replaced by
 /// `{array[[0]]; array[[1]]; …}[index]`.
@@ -80,13 +97,34 @@ class symex_targett;
 class field_sensitivityt
 {
 public:
+  /// Constant indices at which arrays larger than the maximum size for field
+  /// sensitivity are accessed, by the identifier of the level-0 SSA
+  /// expression of the array
+  using sparse_array_indicest =
+    std::unordered_map<irep_idt, std::set<mp_integer>>;
+
   /// \param max_array_size: maximum size for which field sensitivity will be
   ///   applied to array cells
-  explicit field_sensitivityt(std::size_t max_array_size)
-    : max_field_sensitivity_array_size(max_array_size)
+  /// \param sparse_array_indices: indices of larger arrays that are tracked
+  ///   individually; no larger array is split if this is null
+  explicit field_sensitivityt(
+    std::size_t max_array_size,
+    std::shared_ptr<const sparse_array_indicest> sparse_array_indices =
+      nullptr)
+    : max_field_sensitivity_array_size(max_array_size),
+      sparse_array_indices(std::move(sparse_array_indices))
   {
   }
 
+  /// Add to \p dest the constant indices at which arrays of more than
+  /// \p max_array_size elements are accessed in \p goto_program, collecting
+  /// at most \p max_array_size indices per array.
+  static void collect_sparse_array_indices(
+    const goto_programt &goto_program,
+    const namespacet &ns,
+    std::size_t max_array_size,
+    sparse_array_indicest &dest);
+
   /// Assign to the individual fields of a non-expanded symbol \p lhs. This is
   /// required whenever prior steps have updated the full object rather than
   /// individual fields, e.g., in case of assignments to an array at an unknown
@@ -142,12 +180,30 @@ public:
   /// SSA expression.
   bool is_divisible(const ssa_exprt &expr) const;
 
+  /// Determine whether \p expr is an array that is represented sparsely, i.e.,
+  /// some of its elements are individual SSA expressions while the symbol
+  /// itself holds the remaining ones. Unlike for divisible expressions, the
+  /// symbol itself remains in use.
+  bool is_sparse(const ssa_exprt &expr) const;
+
 private:
   /// whether or not to invoke \ref field_sensitivityt::apply
   bool run_apply = true;
 
   const std::size_t max_field_sensitivity_array_size;
 
+  const std::shared_ptr<const sparse_array_indicest> sparse_array_indices;
+
+  /// \return the tracked indices of \p array, or nullptr if it is not
+  ///   represented sparsely
+  const std::set<mp_integer> *get_sparse_indices(const ssa_exprt &array) const;
+
+  exprt get_sparse_fields(
+    const namespacet &ns,
+    goto_symex_statet &state,
+    const ssa_exprt &ssa_expr,
+    const std::set<mp_integer> &indices) const;
+
   void field_assignments_rec(
     const namespacet &ns,
     goto_symex_statet &state,
@@ -15,6 +15,7 @@ Author: Romain Brenguier, romain.brenguier@diffblue.com
 #include "goto_state.h"
 #include "symex_target.h"
 #include <analyses/lexical_loops.h>
+#include <util/optional.h>
 
 /// Stack frames -- these are used for function calls and for exceptions
 struct framet
@@ -32,6 +33,9 @@ struct framet
   goto_programt::const_targett end_of_function;
   exprt return_value = nil_exprt();
   bool hidden_function = false;
+  /// Constant arguments of a call whose result is to be memoized on return,
+  /// see \ref symex_configt::memoize_function_calls
+  optionalt<exprt::operandst> summary_arguments;
 
   symex_level1t old_level1;
 
@@ -18,6 +18,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <goto-programs/abstract_goto_model.h>
 
 #include "complexity_limiter.h"
+#include "path_checkpoint.h"
 #include "path_storage.h"
 #include "symex_config.h"
 
@@ -122,6 +123,15 @@ public:
     const get_goto_functiont &get_goto_function,
     symbol_tablet &new_symbol_table);
 
+  /// Puts the initial state of the entry point function into the path storage
+  /// once for each of \p paths. Symbolic execution of each of these states
+  /// first replays the branch decisions of the path, see
+  /// \ref read_path_checkpoint.
+  virtual void initialize_path_storage_from_checkpoint(
+    const get_goto_functiont &get_goto_function,
+    symbol_tablet &new_symbol_table,
+    const std::vector<path_decisionst> &paths);
+
   /// Performs symbolic execution using a state and equation that have
   /// already been used to symbolically execute part of the program. The state
   /// is not re-initialized; instead, symbolic execution resumes from the
@@ -36,12 +36,16 @@ goto_symex_statet::goto_symex_statet(
   const symex_targett::sourcet &_source,
   std::size_t max_field_sensitive_array_size,
   guard_managert &manager,
-  std::function<std::size_t(const irep_idt &)> fresh_l2_name_provider)
+  std::function<std::size_t(const irep_idt &)> fresh_l2_name_provider,
+  std::shared_ptr<const field_sensitivityt::sparse_array_indicest>
+    sparse_array_indices)
   : goto_statet(manager),
     source(_source),
     guard_manager(manager),
     symex_target(nullptr),
-    field_sensitivity(max_field_sensitive_array_size),
+    field_sensitivity(
+      max_field_sensitive_array_size,
+      std::move(sparse_array_indices)),
     record_events({true}),
     fresh_l2_name_provider(fresh_l2_name_provider)
 {
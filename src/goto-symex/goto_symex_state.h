@@ -14,7 +14,9 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <functional>
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <analyses/guard.h>
 
@@ -49,7 +51,9 @@ public:
     const symex_targett::sourcet &,
     std::size_t max_field_sensitive_array_size,
     guard_managert &manager,
-    std::function<std::size_t(const irep_idt &)> fresh_l2_name_provider);
+    std::function<std::size_t(const irep_idt &)> fresh_l2_name_provider,
+    std::shared_ptr<const field_sensitivityt::sparse_array_indicest>
+      sparse_array_indices = nullptr);
   ~goto_symex_statet();
 
   /// \brief Fake "copy constructor" that initializes the `symex_target` member
@@ -123,6 +127,21 @@ public:
 
   field_sensitivityt field_sensitivity;
 
+  /// Result of dereferencing a pointer in \ref goto_symext::dereference_rec,
+  /// together with the points-to sets it was built from. The result can be
+  /// reused for as long as these points-to sets are unchanged.
+  struct dereference_cache_entryt
+  {
+    bool is_not_null;
+    std::vector<std::pair<exprt, std::vector<exprt>>> value_sets;
+    exprt result;
+  };
+
+  /// Maps (L1-renamed) pointer expressions to the result of their most recent
+  /// dereference
+  std::unordered_map<exprt, dereference_cache_entryt, irep_hash>
+    dereference_cache;
+
 protected:
   template <levelt>
   void rename_address(exprt &expr, const namespacet &ns);
@@ -222,6 +241,15 @@ public:
   /// of a GOTO
   bool has_saved_next_instruction;
 
+  /// \brief The branches, true for the jump target, taken at each GOTO at
+  /// which path exploration saved the alternative. These identify the path
+  /// from the entry point, see \ref write_path_checkpoint.
+  std::vector<bool> path_decisions;
+
+  /// \brief How many of \ref path_decisions have been taken. The remaining
+  /// ones are replayed when resuming a path read from a checkpoint.
+  std::size_t taken_path_decisions = 0;
+
   /// \brief Should the additional validation checks be run?
   bool run_validation_checks;
 
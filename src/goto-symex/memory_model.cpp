@@ -11,6 +11,7 @@ Author: Michael Tautschnig, michael.tautschnig@cs.ox.ac.uk
 
 #include "memory_model.h"
 
+#include <util/optional.h>
 #include <util/std_expr.h>
 
 memory_model_baset::memory_model_baset(const namespacet &_ns)
@@ -53,11 +54,31 @@ void memory_model_baset::read_from(symex_target_equationt &equation)
       exprt::operandst rf_choice_symbols;
       rf_choice_symbols.reserve(address.second.writes.size());
 
+      // The last unconditional write of the reading thread that precedes the
+      // read in program order hides all earlier writes of that thread, as
+      // each of the memory models maintains the order of accesses to the
+      // same address within a thread.
+      optionalt<event_it> hiding_write;
+      for(const auto &write_event : address.second.writes)
+      {
+        if(
+          write_event->source.thread_nr == read_event->source.thread_nr &&
+          write_event->guard.is_true() && po(write_event, read_event) &&
+          (!hiding_write.has_value() || po(*hiding_write, write_event)))
+        {
+          hiding_write = write_event;
+        }
+      }
+
       // this is quadratic in #events per address
       for(const auto &write_event : address.second.writes)
       {
         // rf cannot contradict program order
-        if(!po(read_event, write_event))
+        if(
+          !po(read_event, write_event) &&
+          (!hiding_write.has_value() ||
+           write_event->source.thread_nr != read_event->source.thread_nr ||
+           !po(write_event, *hiding_write)))
         {
           rf_choice_symbols.push_back(register_read_from_choice_symbol(
             read_event, write_event, equation));
@@ -11,6 +11,9 @@ Author: Michael Tautschnig, michael.tautschnig@cs.ox.ac.uk
 
 #include "memory_model_sc.h"
 
+#include <map>
+#include <vector>
+
 #include <util/std_expr.h>
 
 void memory_model_sct::operator()(symex_target_equationt &equation)
@@ -223,21 +226,12 @@ void memory_model_sct::write_serialization_external(
            (*w_it2)->source.thread_nr)
           continue;
 
-        // ws is a total order, no two elements have the same rank
-        // s -> w_evt1 before w_evt2; !s -> w_evt2 before w_evt1
-
-        symbol_exprt s=nondet_bool_symbol("ws-ext");
-
-        // write-to-write edge
-        add_constraint(
-          equation,
-          implies_exprt(s, before(*w_it1, *w_it2)),
-          "ws-ext",
-          (*w_it1)->source);
-
+        // ws is a total order, no two elements have the same rank:
+        // w_evt1 before w_evt2 or w_evt2 before w_evt1, which does not need
+        // a choice symbol of its own
         add_constraint(
           equation,
-          implies_exprt(not_exprt(s), before(*w_it2, *w_it1)),
+          or_exprt(before(*w_it1, *w_it2), before(*w_it2, *w_it1)),
           "ws-ext",
           (*w_it1)->source);
       }
@@ -249,6 +243,16 @@ void memory_model_sct::from_read(symex_target_equationt &equation)
 {
   // from-read: (w', w) in ws and (w', r) in rf -> (r, w) in fr
 
+  // the reads each write may be read from by, to only visit the relevant
+  // read-from choices for each pair of writes
+  std::map<event_it, std::vector<std::pair<event_it, symbol_exprt>>>
+    reads_from_write;
+  for(const auto &choice : choice_symbols)
+  {
+    reads_from_write[choice.first.second].emplace_back(
+      choice.first.first, choice.second);
+  }
+
   for(address_mapt::const_iterator
       a_it=address_map.begin();
       a_it!=address_map.end();
@@ -289,45 +293,44 @@ void memory_model_sct::from_read(symex_target_equationt &equation)
           ws2=before(*w, *w_prime);
         }
 
-        // smells like cubic
-        for(choice_symbolst::const_iterator
-            c_it=choice_symbols.begin();
-            c_it!=choice_symbols.end();
-            c_it++)
+        // cubic in the number of events per address
+        if(!ws1.is_false())
         {
-          event_it r=c_it->first.first;
-          exprt rf=c_it->second;
-          exprt cond;
-          cond.make_nil();
-
-          if(c_it->first.second==*w_prime && !ws1.is_false())
+          for(const auto &read_from : reads_from_write[*w_prime])
           {
-            exprt fr=before(r, *w);
+            event_it r = read_from.first;
+            exprt fr = before(r, *w);
 
             // the guard of w_prime follows from rf; with rfi
             // optimisation such as the previous write_symbol_primed
             // it would even be wrong to add this guard
-            cond=
+            add_constraint(
+              equation,
               implies_exprt(
-                and_exprt(r->guard, (*w)->guard, ws1, rf),
-                fr);
+                and_exprt(r->guard, (*w)->guard, ws1, read_from.second), fr),
+              "fr",
+              r->source);
           }
-          else if(c_it->first.second==*w && !ws2.is_false())
+        }
+
+        if(!ws2.is_false())
+        {
+          for(const auto &read_from : reads_from_write[*w])
           {
-            exprt fr=before(r, *w_prime);
+            event_it r = read_from.first;
+            exprt fr = before(r, *w_prime);
 
             // the guard of w follows from rf; with rfi
             // optimisation such as the previous write_symbol_primed
             // it would even be wrong to add this guard
-            cond=
+            add_constraint(
+              equation,
               implies_exprt(
-                and_exprt(r->guard, (*w_prime)->guard, ws2, rf),
-                fr);
+                and_exprt(r->guard, (*w_prime)->guard, ws2, read_from.second),
+                fr),
+              "fr",
+              r->source);
           }
-
-          if(cond.is_not_nil())
-            add_constraint(equation,
-              cond, "fr", r->source);
         }
       }
     }
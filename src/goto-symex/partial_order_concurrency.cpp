@@ -139,6 +139,11 @@ symbol_exprt partial_order_concurrencyt::clock(
   axiomt axiom)
 {
   PRECONDITION(!numbering.empty());
+
+  const auto cache_entry = clock_cache.find({event, axiom});
+  if(cache_entry != clock_cache.end())
+    return cache_entry->second;
+
   irep_idt identifier;
 
   if(event->is_shared_write())
@@ -154,7 +159,9 @@ symbol_exprt partial_order_concurrencyt::clock(
   else
     UNREACHABLE;
 
-  return symbol_exprt(identifier, clock_type);
+  symbol_exprt clock_symbol(identifier, clock_type);
+  clock_cache.emplace(std::make_pair(event, axiom), clock_symbol);
+  return clock_symbol;
 }
 
 void partial_order_concurrencyt::build_clock_type()
@@ -163,6 +170,7 @@ void partial_order_concurrencyt::build_clock_type()
 
   std::size_t width = address_bits(numbering.size());
   clock_type = unsignedbv_typet(width);
+  clock_cache.clear();
 }
 
 exprt partial_order_concurrencyt::before(
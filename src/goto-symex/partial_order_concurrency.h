@@ -97,6 +97,10 @@ protected:
 
   typet clock_type;
 
+  /// Clock symbols already built by \ref clock, which is invoked for each
+  /// ordering constraint and thus far more often than there are events
+  std::map<std::pair<event_it, axiomt>, symbol_exprt> clock_cache;
+
   /// Produce a clock symbol for some event
   /// \param e: event is either shared read/write or spawn
   /// \param axiom: clock variable
@@ -0,0 +1,114 @@
+/*******************************************************************\
+
+Module: Symbolic Execution
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Checkpoints of the paths still to be explored
+
+#include "path_checkpoint.h"
+
+#include <cstdio>
+#include <fstream>
+
+#include <util/exception_utils.h>
+#include <util/irep_serialization.h>
+
+#include "path_storage.h"
+
+#define PATH_CHECKPOINT_VERSION 1
+
+void write_path_checkpoint(std::ostream &out, const path_storaget &path_storage)
+{
+  irept checkpoint(ID_path_checkpoint);
+  irept::subt &paths = checkpoint.get_sub();
+  paths.reserve(path_storage.size());
+
+  path_storage.for_each([&paths](const path_storaget::patht &path) {
+    const path_decisionst &decisions = path.state.path_decisions;
+    std::string encoded(decisions.size(), '0');
+    for(std::size_t i = 0; i < decisions.size(); ++i)
+    {
+      if(decisions[i])
+        encoded[i] = '1';
+    }
+    paths.emplace_back(encoded);
+  });
+
+  out << char(0x7f) << "SPC";
+  write_gb_word(out, PATH_CHECKPOINT_VERSION);
+
+  irep_serializationt::ireps_containert ireps_container;
+  irep_serializationt irep_serialization(ireps_container);
+  irep_serialization.reference_convert(checkpoint, out);
+}
+
+bool write_path_checkpoint(
+  const std::string &file_name,
+  const path_storaget &path_storage)
+{
+  // write to a temporary file first so that a run interrupted while writing
+  // leaves the previous checkpoint intact
+  const std::string temporary_file_name = file_name + ".tmp";
+
+  {
+    std::ofstream out(temporary_file_name, std::ios::binary);
+    if(!out)
+      return true;
+
+    write_path_checkpoint(out, path_storage);
+
+    if(!out)
+      return true;
+  }
+
+  return std::rename(temporary_file_name.c_str(), file_name.c_str()) != 0;
+}
+
+std::vector<path_decisionst> read_path_checkpoint(std::istream &in)
+{
+  char header[4];
+  if(
+    !in.read(header, sizeof(header)) || header[0] != 0x7f ||
+    header[1] != 'S' || header[2] != 'P' || header[3] != 'C')
+  {
+    throw deserialization_exceptiont("not a path checkpoint");
+  }
+
+  const std::size_t version = irep_serializationt::read_gb_word(in);
+  if(version != PATH_CHECKPOINT_VERSION)
+  {
+    throw deserialization_exceptiont(
+      "unsupported path checkpoint version " + std::to_string(version) +
+      ", supported version = " + std::to_string(PATH_CHECKPOINT_VERSION));
+  }
+
+  irep_serializationt::ireps_containert ireps_container;
+  irep_serializationt irep_serialization(ireps_container);
+  const irept &checkpoint = irep_serialization.reference_convert(in);
+
+  if(checkpoint.id() != ID_path_checkpoint)
+    throw deserialization_exceptiont("malformed path checkpoint");
+
+  std::vector<path_decisionst> result;
+  result.reserve(checkpoint.get_sub().size());
+
+  for(const irept &path : checkpoint.get_sub())
+  {
+    const std::string &encoded = id2string(path.id());
+    path_decisionst decisions;
+    decisions.reserve(encoded.size());
+    for(const char decision : encoded)
+    {
+      if(decision != '0' && decision != '1')
+        throw deserialization_exceptiont("malformed path checkpoint");
+      decisions.push_back(decision == '1');
+    }
+    result.push_back(std::move(decisions));
+  }
+
+  return result;
+}
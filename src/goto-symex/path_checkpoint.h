@@ -0,0 +1,45 @@
+/*******************************************************************\
+
+Module: Symbolic Execution
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Checkpoints of the paths still to be explored
+
+#ifndef CPROVER_GOTO_SYMEX_PATH_CHECKPOINT_H
+#define CPROVER_GOTO_SYMEX_PATH_CHECKPOINT_H
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+class path_storaget;
+
+/// The branch decisions, see \ref goto_symex_statet::path_decisions, that
+/// identify a path from the entry point of the program
+typedef std::vector<bool> path_decisionst;
+
+/// Write the paths in \p path_storage to \p out. Rather than the symbolic
+/// states, which refer to the goto program and the symbol tables in memory,
+/// the branch decisions leading to each path are stored: symbolic execution
+/// is deterministic, so that replaying them on the same goto program
+/// reconstructs the states.
+void write_path_checkpoint(
+  std::ostream &out,
+  const path_storaget &path_storage);
+
+/// Write the paths in \p path_storage to the file \p file_name, replacing it
+/// only once the checkpoint has been written completely
+/// \return false on success
+bool write_path_checkpoint(
+  const std::string &file_name,
+  const path_storaget &path_storage);
+
+/// Read the branch decisions of the paths stored in a checkpoint. Throws a
+/// \ref deserialization_exceptiont if \p in does not contain a checkpoint.
+std::vector<path_decisionst> read_path_checkpoint(std::istream &in);
+
+#endif // CPROVER_GOTO_SYMEX_PATH_CHECKPOINT_H
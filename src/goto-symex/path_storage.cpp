@@ -8,6 +8,7 @@ Author: Kareem Khazem <karkhaz@karkhaz.com>
 
 #include "path_storage.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include <util/exit_codes.h>
@@ -48,6 +49,11 @@ std::size_t path_lifot::size() const
   return paths.size();
 }
 
+void path_lifot::for_each(const std::function<void(const patht &)> &f) const
+{
+  std::for_each(paths.begin(), paths.end(), f);
+}
+
 void path_lifot::clear()
 {
   paths.clear();
@@ -76,11 +82,364 @@ std::size_t path_fifot::size() const
   return paths.size();
 }
 
+void path_fifot::for_each(const std::function<void(const patht &)> &f) const
+{
+  std::for_each(paths.begin(), paths.end(), f);
+}
+
 void path_fifot::clear()
 {
   paths.clear();
 }
 
+// _____________________________________________________________________________
+// path_distancet
+
+static const std::size_t unreachable = std::numeric_limits<std::size_t>::max();
+
+static std::size_t add_distances(std::size_t a, std::size_t b)
+{
+  return a == unreachable || b == unreachable ? unreachable : a + b;
+}
+
+path_storaget::patht &path_distancet::private_peek()
+{
+  // resume the closest path; among equally close ones the one saved last
+  last_peeked = paths.begin();
+  for(auto it = paths.begin(); it != paths.end(); ++it)
+  {
+    if(it->distance <= last_peeked->distance)
+      last_peeked = it;
+  }
+  return last_peeked->path;
+}
+
+void path_distancet::push(const path_storaget::patht &path)
+{
+  const std::size_t distance = get_distance(path.state);
+  if(distance != unreachable)
+    paths.emplace_back(path, distance);
+}
+
+void path_distancet::private_pop()
+{
+  PRECONDITION(last_peeked != paths.end());
+  paths.erase(last_peeked);
+  last_peeked = paths.end();
+}
+
+std::size_t path_distancet::size() const
+{
+  return paths.size();
+}
+
+void path_distancet::for_each(
+  const std::function<void(const patht &)> &f) const
+{
+  for(const auto &entry : paths)
+    f(entry.path);
+}
+
+void path_distancet::clear()
+{
+  paths.clear();
+}
+
+void path_distancet::set_targets(
+  const get_functiont &get_function,
+  const std::unordered_set<irep_idt> &decided_properties,
+  bool unwinding_assertions)
+{
+  if(
+    this->get_function && this->decided_properties == decided_properties &&
+    this->unwinding_assertions == unwinding_assertions)
+  {
+    return;
+  }
+
+  this->get_function = get_function;
+  this->decided_properties = decided_properties;
+  this->unwinding_assertions = unwinding_assertions;
+
+  functions.clear();
+  for(const auto &entry : paths)
+  {
+    const goto_symex_statet &state = entry.path.state;
+    add_functions(state.source.function_id);
+    for(const auto &frame : state.call_stack())
+      add_functions(frame.calling_location.function_id);
+  }
+  compute_recursive_functions();
+  compute_distances();
+
+  for(auto it = paths.begin(); it != paths.end();)
+  {
+    it->distance = get_distance(it->path.state);
+    if(it->distance == unreachable)
+      it = paths.erase(it);
+    else
+      ++it;
+  }
+}
+
+/// Add \p function_id and all functions it may transitively call to
+/// \ref functions
+void path_distancet::add_functions(const irep_idt &function_id)
+{
+  std::vector<irep_idt> worklist{function_id};
+
+  while(!worklist.empty())
+  {
+    const irep_idt id = worklist.back();
+    worklist.pop_back();
+
+    auto entry = functions.emplace(id, function_distancest{});
+    if(!entry.second)
+      continue;
+
+    const goto_functionst::goto_functiont *function = get_function(id);
+    if(function == nullptr || !function->body_available())
+    {
+      // returns immediately, without reaching any target
+      entry.first->second.entry.to_end = 0;
+      continue;
+    }
+
+    entry.first->second.body = &function->body;
+    for(const auto &instruction : function->body.instructions)
+    {
+      if(!instruction.is_function_call())
+        continue;
+
+      const exprt &callee = instruction.get_function_call().function();
+      if(callee.id() == ID_symbol)
+      {
+        const irep_idt &callee_id = to_symbol_expr(callee).get_identifier();
+        entry.first->second.callees.insert(callee_id);
+        worklist.push_back(callee_id);
+      }
+    }
+  }
+}
+
+/// Determine the functions in \ref functions that can reach a call to
+/// themselves, following direct calls
+void path_distancet::compute_recursive_functions()
+{
+  recursive_functions.clear();
+  if(!unwinding_assertions)
+    return;
+
+  for(const auto &function : functions)
+  {
+    std::unordered_set<irep_idt> visited;
+    std::vector<irep_idt> worklist(
+      function.second.callees.begin(), function.second.callees.end());
+
+    while(!worklist.empty())
+    {
+      const irep_idt id = worklist.back();
+      worklist.pop_back();
+
+      if(id == function.first)
+      {
+        recursive_functions.insert(id);
+        break;
+      }
+
+      if(!visited.insert(id).second)
+        continue;
+
+      const auto &callees = functions.at(id).callees;
+      worklist.insert(worklist.end(), callees.begin(), callees.end());
+    }
+  }
+}
+
+bool path_distancet::is_target(
+  const goto_programt::instructiont &instruction) const
+{
+  if(instruction.is_assert())
+  {
+    return decided_properties.count(
+             instruction.source_location.get_property_id()) == 0;
+  }
+
+  // symex adds unwinding assertions, named as in SSA_stept::get_property_id,
+  // when the bound of a loop or of the recursion of a callee is exceeded
+  if(unwinding_assertions && instruction.is_backwards_goto())
+  {
+    return decided_properties.count(
+             id2string(instruction.source_location.get_function()) +
+             ".unwind." + std::to_string(instruction.loop_number)) == 0;
+  }
+
+  if(unwinding_assertions && instruction.is_function_call())
+  {
+    const exprt &callee = instruction.get_function_call().function();
+    return callee.id() == ID_symbol &&
+           recursive_functions.count(
+             to_symbol_expr(callee).get_identifier()) != 0 &&
+           decided_properties.count(
+             id2string(instruction.source_location.get_function()) +
+             ".recursion") == 0;
+  }
+
+  return false;
+}
+
+/// Compute the distances of all instructions of all functions in
+/// \ref functions by iterating until a fixed point is reached, both within
+/// each function and across calls
+void path_distancet::compute_distances()
+{
+  bool changed = true;
+  while(changed)
+  {
+    changed = false;
+
+    for(auto &function : functions)
+    {
+      function_distancest &distances = function.second;
+      if(distances.body == nullptr)
+        continue;
+
+      const goto_programt &body = *distances.body;
+      bool body_changed = true;
+      while(body_changed)
+      {
+        body_changed = false;
+
+        for(auto it = body.instructions.end();
+            it != body.instructions.begin();)
+        {
+          --it;
+          distancet distance;
+
+          if(is_target(*it))
+            distance.to_target = 0;
+
+          if(it->is_end_function())
+          {
+            distance.to_end = 0;
+          }
+          else if(it->is_function_call())
+          {
+            const exprt &callee = it->get_function_call().function();
+            // calls through anything but a symbol may lead anywhere
+            distancet call;
+            call.to_target = 0;
+            call.to_end = 0;
+            if(callee.id() == ID_symbol)
+            {
+              call =
+                functions.at(to_symbol_expr(callee).get_identifier()).entry;
+            }
+
+            const distancet &next = distances.instructions[&*std::next(it)];
+            const std::size_t over_call = add_distances(1, call.to_end);
+
+            distance.to_target = std::min(
+              {distance.to_target,
+               add_distances(1, call.to_target),
+               add_distances(over_call, next.to_target)});
+            distance.to_end = add_distances(over_call, next.to_end);
+          }
+          else
+          {
+            for(const auto &successor : body.get_successors(it))
+            {
+              const distancet &next = distances.instructions[&*successor];
+              distance.to_target = std::min(
+                distance.to_target, add_distances(1, next.to_target));
+              distance.to_end =
+                std::min(distance.to_end, add_distances(1, next.to_end));
+            }
+          }
+
+          distancet &stored = distances.instructions[&*it];
+          if(
+            distance.to_target != stored.to_target ||
+            distance.to_end != stored.to_end)
+          {
+            stored = distance;
+            body_changed = true;
+          }
+        }
+      }
+
+      const distancet &entry =
+        distances.instructions[&body.instructions.front()];
+      if(
+        entry.to_target != distances.entry.to_target ||
+        entry.to_end != distances.entry.to_end)
+      {
+        distances.entry = entry;
+        changed = true;
+      }
+    }
+  }
+}
+
+path_distancet::distancet path_distancet::get_distance(
+  const irep_idt &function_id,
+  goto_programt::const_targett pc)
+{
+  if(functions.find(function_id) == functions.end())
+  {
+    add_functions(function_id);
+    compute_distances();
+  }
+
+  const function_distancest &distances = functions.at(function_id);
+  const auto entry = distances.instructions.find(&*pc);
+  if(entry == distances.instructions.end())
+  {
+    // not an instruction we know of: assume the worst
+    distancet distance;
+    distance.to_target = 0;
+    distance.to_end = 0;
+    return distance;
+  }
+
+  return entry->second;
+}
+
+/// \return the distance from the location \p state resumes at to the nearest
+///   target, possibly after returning from the functions on its call stack
+std::size_t path_distancet::get_distance(const goto_symex_statet &state)
+{
+  // without targets, or with several threads interleaving, there is nothing
+  // to direct the search by
+  if(!get_function || state.threads.size() != 1)
+    return 0;
+
+  const goto_programt::const_targett pc =
+    state.has_saved_jump_target || state.has_saved_next_instruction
+      ? state.saved_target
+      : state.source.pc;
+
+  const distancet here = get_distance(state.source.function_id, pc);
+  std::size_t distance = here.to_target;
+  std::size_t to_return = here.to_end;
+
+  // the bottom frame has no caller to return to
+  const call_stackt &call_stack = state.call_stack();
+  for(std::size_t i = call_stack.size() - 1; i > 0; --i)
+  {
+    const symex_targett::sourcet &caller = call_stack[i].calling_location;
+    const distancet after_call =
+      get_distance(caller.function_id, std::next(caller.pc));
+
+    to_return = add_distances(to_return, 1);
+    distance =
+      std::min(distance, add_distances(to_return, after_call.to_target));
+    to_return = add_distances(to_return, after_call.to_end);
+  }
+
+  return distance;
+}
+
 // _____________________________________________________________________________
 // path_strategy_choosert
 
@@ -105,6 +464,16 @@ static const std::map<
        "                              the program tree breadth-first.\n",
        []() { // NOLINT(whitespace/braces)
          return util_make_unique<path_fifot>();
+       }}},
+     {"distance",
+      {" distance                     paths are popped in order of their\n"
+       "                              distance to the nearest assertion that\n"
+       "                              is still to be decided; paths that\n"
+       "                              cannot reach such an assertion are\n"
+       "                              dropped. Directs the search towards\n"
+       "                              open properties.\n",
+       []() { // NOLINT(whitespace/braces)
+         return util_make_unique<path_distancet>();
        }}}});
 
 std::string show_path_strategies()
@@ -157,4 +526,18 @@ void parse_path_strategy_options(
   {
     options.set_option("exploration-strategy", default_path_strategy());
   }
+
+  for(const char *option : {"paths-checkpoint", "paths-resume"})
+  {
+    if(!cmdline.isset(option))
+      continue;
+
+    if(!cmdline.isset("paths"))
+    {
+      log.error() << "--" << option << " requires --paths" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    options.set_option(option, cmdline.get_value(option));
+  }
 }
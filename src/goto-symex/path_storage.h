@@ -13,9 +13,14 @@
 #include <analyses/dirty.h>
 #include <analyses/local_safe_pointers.h>
 
+#include <functional>
+#include <limits>
+#include <map>
 #include <memory>
+#include <unordered_set>
 
 #include "goto_symex_state.h"
+#include "relevant_objects.h"
 #include "symex_target_equation.h"
 
 /// Functor generating fresh nondet symbols
@@ -74,6 +79,27 @@ public:
   /// \brief Add a path to resume to the storage
   virtual void push(const patht &) = 0;
 
+  /// Delegate returning the function with the given identifier, or nullptr if
+  /// the program does not provide it
+  typedef std::function<const goto_functionst::goto_functiont *(
+    const irep_idt &)>
+    get_functiont;
+
+  /// \brief Inform the storage of the properties that have already been
+  /// decided, so that it can direct exploration towards the remaining ones.
+  /// Must not be called between \ref peek and \ref pop. The default
+  /// implementation ignores this information.
+  /// \param get_function: delegate to retrieve function bodies
+  /// \param decided_properties: identifiers of the properties that no longer
+  ///   need to be reached
+  /// \param unwinding_assertions: whether loops give rise to properties
+  virtual void set_targets(
+    const get_functiont &get_function,
+    const std::unordered_set<irep_idt> &decided_properties,
+    bool unwinding_assertions)
+  {
+  }
+
   /// \brief Remove the next path to resume from the storage
   void pop()
   {
@@ -84,6 +110,9 @@ public:
   /// \brief How many paths does this storage contain?
   virtual std::size_t size() const = 0;
 
+  /// \brief Apply \p f to each of the paths in this storage
+  virtual void for_each(const std::function<void(const patht &)> &f) const = 0;
+
   /// \brief Is this storage empty?
   bool empty() const
   {
@@ -111,6 +140,19 @@ public:
     return get_unique_index(l2_indices, id, 1);
   }
 
+  /// Map function identifiers to whether calls to them can be memoized, see
+  /// \ref symex_configt::memoize_function_calls
+  std::unordered_map<irep_idt, bool> memoizable_functions;
+
+  /// Map function identifiers and constant arguments to the constant value
+  /// the function returned for these arguments (nil for void functions).
+  std::unordered_map<irep_idt, std::map<exprt::operandst, exprt>>
+    function_summaries;
+
+  /// Objects that may affect a property, see
+  /// \ref symex_configt::cone_of_influence. Computed once for all paths.
+  std::shared_ptr<const relevant_objectst> relevant_objects;
+
   /// Local variables are considered 'dirty' if they've had an address taken and
   /// therefore may be referred to by a pointer.
   incremental_dirtyt dirty;
@@ -168,6 +210,7 @@ class path_lifot : public path_storaget
 public:
   void push(const patht &) override;
   std::size_t size() const override;
+  void for_each(const std::function<void(const patht &)> &f) const override;
   void clear() override;
 
 protected:
@@ -185,6 +228,7 @@ class path_fifot : public path_storaget
 public:
   void push(const patht &) override;
   std::size_t size() const override;
+  void for_each(const std::function<void(const patht &)> &f) const override;
   void clear() override;
 
 protected:
@@ -195,6 +239,78 @@ private:
   void private_pop() override;
 };
 
+/// \brief Directed save queue: paths are resumed in order of the static
+/// distance, counted in instructions, from their resume location to the
+/// nearest assertion that is still to be decided. Paths that cannot reach any
+/// such assertion are dropped. Until \ref set_targets is called, paths are
+/// resumed in last-in, first-out order.
+class path_distancet : public path_storaget
+{
+public:
+  void push(const patht &) override;
+  std::size_t size() const override;
+  void for_each(const std::function<void(const patht &)> &f) const override;
+  void clear() override;
+  void set_targets(
+    const get_functiont &get_function,
+    const std::unordered_set<irep_idt> &decided_properties,
+    bool unwinding_assertions) override;
+
+protected:
+  struct entryt
+  {
+    patht path;
+    std::size_t distance;
+
+    entryt(const patht &path, std::size_t distance)
+      : path(path), distance(distance)
+    {
+    }
+  };
+
+  std::list<entryt>::iterator last_peeked;
+  std::list<entryt> paths;
+
+private:
+  patht &private_peek() override;
+  void private_pop() override;
+
+  /// Distances from an instruction to the nearest target and to the end of
+  /// the function containing it; the maximum value marks unreachable
+  struct distancet
+  {
+    std::size_t to_target = std::numeric_limits<std::size_t>::max();
+    std::size_t to_end = std::numeric_limits<std::size_t>::max();
+  };
+
+  struct function_distancest
+  {
+    /// nullptr if the function has no body
+    const goto_programt *body = nullptr;
+    distancet entry;
+    std::unordered_map<const goto_programt::instructiont *, distancet>
+      instructions;
+    /// Functions called directly
+    std::unordered_set<irep_idt> callees;
+  };
+
+  get_functiont get_function;
+  std::unordered_set<irep_idt> decided_properties;
+  bool unwinding_assertions = false;
+  std::unordered_map<irep_idt, function_distancest> functions;
+  /// Functions in \ref functions that may call themselves, so that calls to
+  /// them may give rise to recursion unwinding assertions
+  std::unordered_set<irep_idt> recursive_functions;
+
+  void add_functions(const irep_idt &function_id);
+  void compute_recursive_functions();
+  void compute_distances();
+  bool is_target(const goto_programt::instructiont &instruction) const;
+  distancet
+  get_distance(const irep_idt &function_id, goto_programt::const_targett pc);
+  std::size_t get_distance(const goto_symex_statet &state);
+};
+
 /// \brief suitable for displaying as a front-end help message
 std::string show_path_strategies();
 
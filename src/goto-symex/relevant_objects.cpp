@@ -0,0 +1,172 @@
+/*******************************************************************\
+
+Module: Symbolic Execution
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Objects whose values may affect the properties of a program
+
+#include "relevant_objects.h"
+
+#include <util/byte_operators.h>
+#include <util/find_symbols.h>
+
+#include <vector>
+
+/// \return the symbol whose value an assignment to \p lhs changes, or nullptr
+/// if this cannot be determined syntactically, as for dereferences
+static const symbol_exprt *assigned_symbol(const exprt &lhs)
+{
+  const exprt *expr = &lhs;
+  while(true)
+  {
+    if(expr->id() == ID_symbol)
+      return &to_symbol_expr(*expr);
+    else if(expr->id() == ID_member)
+      expr = &to_member_expr(*expr).compound();
+    else if(expr->id() == ID_index)
+      expr = &to_index_expr(*expr).array();
+    else if(expr->id() == ID_typecast)
+      expr = &to_typecast_expr(*expr).op();
+    else if(
+      expr->id() == ID_byte_extract_little_endian ||
+      expr->id() == ID_byte_extract_big_endian)
+    {
+      expr = &to_byte_extract_expr(*expr).op();
+    }
+    else
+      return nullptr;
+  }
+}
+
+void relevant_objectst::add_dependencies(
+  const irep_idt &object,
+  const exprt &expr)
+{
+  find_type_and_expr_symbols(expr, dependencies[object]);
+}
+
+void relevant_objectst::add_relevant(const exprt &expr)
+{
+  find_type_and_expr_symbols(expr, relevant);
+}
+
+void relevant_objectst::add_function(
+  const goto_functionst::goto_functiont &goto_function,
+  const get_functiont &get_function)
+{
+  dirty.add_function(goto_function);
+
+  for(const auto &instruction : goto_function.body.instructions)
+  {
+    if(instruction.is_assign())
+    {
+      const code_assignt &assign = instruction.get_assign();
+      const symbol_exprt *symbol = assigned_symbol(assign.lhs());
+      if(symbol != nullptr)
+      {
+        // symbols in the lhs, such as array indices, determine which part of
+        // the object is updated
+        add_dependencies(symbol->get_identifier(), assign.lhs());
+        add_dependencies(symbol->get_identifier(), assign.rhs());
+      }
+      else
+      {
+        // the assignment may write to any object whose address is taken, all
+        // of which are relevant
+        add_relevant(assign.lhs());
+        add_relevant(assign.rhs());
+      }
+    }
+    else if(instruction.is_function_call())
+    {
+      const code_function_callt &call = instruction.get_function_call();
+      const goto_functionst::goto_functiont *callee =
+        call.function().id() == ID_symbol
+          ? get_function(to_symbol_expr(call.function()).get_identifier())
+          : nullptr;
+
+      add_relevant(call.lhs());
+
+      if(
+        callee == nullptr || !callee->body_available() ||
+        callee->parameter_identifiers.size() != call.arguments().size())
+      {
+        // unknown targets or bodies, or the handling of surplus and missing
+        // arguments, are not tracked
+        add_relevant(call);
+      }
+      else
+      {
+        for(std::size_t i = 0; i < call.arguments().size(); ++i)
+        {
+          const irep_idt &parameter = callee->parameter_identifiers[i];
+          if(parameter.empty())
+            add_relevant(call.arguments()[i]);
+          else
+            add_dependencies(parameter, call.arguments()[i]);
+        }
+      }
+    }
+    else if(
+      instruction.is_assert() || instruction.is_assume() ||
+      instruction.is_goto())
+    {
+      add_relevant(instruction.get_condition());
+    }
+    else if(
+      instruction.is_other() || instruction.is_throw() ||
+      instruction.is_catch() || instruction.is_return())
+    {
+      add_relevant(instruction.code);
+    }
+  }
+}
+
+void relevant_objectst::propagate()
+{
+  if(dirty.initialized)
+  {
+    const auto &dirty_ids = dirty.get_dirty_ids();
+    relevant.insert(dirty_ids.begin(), dirty_ids.end());
+  }
+
+  std::vector<irep_idt> worklist(relevant.begin(), relevant.end());
+  while(!worklist.empty())
+  {
+    const irep_idt object = worklist.back();
+    worklist.pop_back();
+
+    const auto entry = dependencies.find(object);
+    if(entry == dependencies.end())
+      continue;
+
+    for(const irep_idt &dependency : entry->second)
+    {
+      if(relevant.insert(dependency).second)
+        worklist.push_back(dependency);
+    }
+  }
+}
+
+bool relevant_objectst::is_irrelevant_assignment(const exprt &lhs) const
+{
+  const symbol_exprt *symbol = assigned_symbol(lhs);
+  return symbol != nullptr &&
+         dependencies.find(symbol->get_identifier()) != dependencies.end() &&
+         relevant.find(symbol->get_identifier()) == relevant.end();
+}
+
+std::size_t relevant_objectst::number_of_irrelevant_objects() const
+{
+  std::size_t result = 0;
+  for(const auto &entry : dependencies)
+  {
+    if(relevant.find(entry.first) == relevant.end())
+      ++result;
+  }
+  return result;
+}
@@ -0,0 +1,75 @@
+/*******************************************************************\
+
+Module: Symbolic Execution
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Objects whose values may affect the properties of a program
+
+#ifndef CPROVER_GOTO_SYMEX_RELEVANT_OBJECTS_H
+#define CPROVER_GOTO_SYMEX_RELEVANT_OBJECTS_H
+
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <analyses/dirty.h>
+#include <goto-programs/goto_functions.h>
+
+/// Flow-insensitive cone of influence of the assertions, assumptions and
+/// branch conditions of a program. An object, identified by its level-0 name,
+/// is relevant if its value may flow into one of those, or if it may be
+/// accessed through a pointer. Symbolic execution may skip assignments to
+/// objects that the analysis saw being assigned to but did not find relevant,
+/// as no property can depend on the values assigned.
+///
+/// The dependence graph of src/analyses, as used by the full slicer, would
+/// give an instruction-precise cone, but it requires the complete
+/// `goto_functionst` up front and runs reaching definitions over the whole
+/// program. Symex only obtains functions one at a time, possibly loading
+/// them lazily, and this analysis is meant to cost little compared to symex,
+/// hence it is syntactic and over level-0 identifiers.
+class relevant_objectst
+{
+public:
+  /// Delegate returning the function with the given identifier, or nullptr if
+  /// the program does not provide it
+  typedef std::function<const goto_functionst::goto_functiont *(
+    const irep_idt &)>
+    get_functiont;
+
+  /// Add the instructions of \p goto_function to the analysis
+  /// \param goto_function: function to analyse
+  /// \param get_function: delegate to look up the parameters of callees
+  void add_function(
+    const goto_functionst::goto_functiont &goto_function,
+    const get_functiont &get_function);
+
+  /// Compute the relevant objects; must be called once after all functions
+  /// have been added.
+  void propagate();
+
+  /// \return true if an assignment to \p lhs cannot affect any property
+  bool is_irrelevant_assignment(const exprt &lhs) const;
+
+  /// \return the number of objects that are assigned to, but are not relevant
+  std::size_t number_of_irrelevant_objects() const;
+
+protected:
+  dirtyt dirty;
+
+  /// Map each object assigned to, directly or as a function parameter, to the
+  /// objects its new values are computed from
+  std::unordered_map<irep_idt, std::unordered_set<irep_idt>> dependencies;
+
+  /// Objects that may affect a property
+  std::unordered_set<irep_idt> relevant;
+
+  void add_dependencies(const irep_idt &object, const exprt &expr);
+  void add_relevant(const exprt &expr);
+};
+
+#endif // CPROVER_GOTO_SYMEX_RELEVANT_OBJECTS_H
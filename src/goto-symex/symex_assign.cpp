@@ -215,6 +215,13 @@ void symex_assignt::assign_non_struct_symbol(
     state.propagation.erase_if_exists(l1_lhs.get_identifier());
     state.value_set.erase_symbol(l1_lhs, ns);
   }
+  else if(state.field_sensitivity.is_sparse(l1_lhs))
+  {
+    // The symbol keeps representing the elements that are not tracked
+    // individually, only the tracked ones need to be updated
+    state.field_sensitivity.field_assignments(
+      ns, state, l1_lhs, target, symex_config.allow_pointer_unsoundness);
+  }
 }
 
 void symex_assignt::assign_symbol(
@@ -36,6 +36,12 @@ struct symex_configt final
 
   bool havoc_undefined_functions;
 
+  /// \brief Reuse the result of an earlier call to a side-effect-free
+  /// function that was called with the same constant arguments.
+  /// Disabled when doing path exploration or when a depth limit is set, as
+  /// then a single execution of the body need not cover all its paths.
+  bool memoize_function_calls;
+
   mp_integer debug_level;
 
   /// \brief Should the additional validation checks be run?
@@ -50,6 +56,14 @@ struct symex_configt final
   /// Maximum sizes for which field sensitivity will be applied to array cells
   std::size_t max_field_sensitivity_array_size;
 
+  /// \brief Track elements of larger arrays at constant indices individually,
+  /// keeping the other elements in the array symbol
+  bool sparse_array_field_sensitivity;
+
+  /// \brief Skip assignments to objects that, according to a flow-insensitive
+  /// analysis done before symbolic execution, cannot affect any property.
+  bool cone_of_influence;
+
   /// \brief Whether this run of symex is under complexity limits. This
   /// enables certain analyses that otherwise aren't run.
   bool complexity_limits_active;
@@ -18,12 +18,52 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/expr_iterator.h>
 #include <util/expr_util.h>
 #include <util/invariant.h>
+#include <util/metrics.h>
 #include <util/pointer_offset_size.h>
 
 #include <pointer-analysis/value_set_dereference.h>
 
 #include "symex_dereference_state.h"
 
+/// Dereference callback that records the points-to sets queried, which
+/// determine the result of the dereference
+class recording_dereference_statet : public symex_dereference_statet
+{
+public:
+  recording_dereference_statet(
+    goto_symext::statet &state,
+    const namespacet &ns,
+    std::vector<std::pair<exprt, std::vector<exprt>>> &value_sets)
+    : symex_dereference_statet(state, ns), value_sets(value_sets)
+  {
+  }
+
+protected:
+  std::vector<std::pair<exprt, std::vector<exprt>>> &value_sets;
+
+  std::vector<exprt> get_value_set(const exprt &expr) const override
+  {
+    std::vector<exprt> result = symex_dereference_statet::get_value_set(expr);
+    value_sets.emplace_back(expr, result);
+    return result;
+  }
+};
+
+/// \return true if the points-to sets \p entry was built from are unchanged
+///   in \p state
+static bool is_up_to_date(
+  const goto_symex_statet::dereference_cache_entryt &entry,
+  const goto_symex_statet &state,
+  const namespacet &ns)
+{
+  for(const auto &value_set : entry.value_sets)
+  {
+    if(state.value_set.get_value_set(value_set.first, ns) != value_set.second)
+      return false;
+  }
+  return true;
+}
+
 /// Transforms an lvalue expression by replacing any dereference operations it
 /// contains with explicit references to the objects they may point to (using
 /// \ref goto_symext::dereference_rec), and translates `byte_extract,` `member`
@@ -256,21 +296,44 @@ void goto_symext::dereference_rec(exprt &expr, statet &state, bool write)
 
     tmp1 = state.field_sensitivity.apply(ns, state, std::move(tmp1), false);
 
-    // we need to set up some elaborate call-backs
-    symex_dereference_statet symex_dereference_state(state, ns);
+    // Building the case split over all objects the pointer may point to is
+    // expensive, reuse the result of an earlier dereference of the same
+    // pointer if the objects it may point to have not changed since.
+    auto cache_entry = state.dereference_cache.find(tmp1);
+    get_metrics().add("dereferenceCacheLookups");
+    if(
+      cache_entry != state.dereference_cache.end() &&
+      cache_entry->second.is_not_null == expr_is_not_null &&
+      is_up_to_date(cache_entry->second, state, ns))
+    {
+      get_metrics().add("dereferenceCacheHits");
+      expr = cache_entry->second.result;
+    }
+    else
+    {
+      goto_symex_statet::dereference_cache_entryt entry;
+      entry.is_not_null = expr_is_not_null;
+
+      // we need to set up some elaborate call-backs
+      recording_dereference_statet symex_dereference_state(
+        state, ns, entry.value_sets);
 
-    value_set_dereferencet dereference(
-      ns,
-      state.symbol_table,
-      symex_dereference_state,
-      language_mode,
-      expr_is_not_null);
+      value_set_dereferencet dereference(
+        ns,
+        state.symbol_table,
+        symex_dereference_state,
+        language_mode,
+        expr_is_not_null);
 
-    // std::cout << "**** " << format(tmp1) << '\n';
-    exprt tmp2 = dereference.dereference(tmp1);
-    // std::cout << "**** " << format(tmp2) << '\n';
+      // std::cout << "**** " << format(tmp1) << '\n';
+      exprt tmp2 = dereference.dereference(tmp1);
+      // std::cout << "**** " << format(tmp2) << '\n';
 
-    expr.swap(tmp2);
+      entry.result = tmp2;
+      state.dereference_cache[std::move(tmp1)] = std::move(entry);
+
+      expr.swap(tmp2);
+    }
 
     // this may yield a new auto-object
     trigger_auto_object(expr, state);
@@ -16,10 +16,15 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/byte_operators.h>
 #include <util/c_types.h>
 #include <util/exception_utils.h>
+#include <util/expr_util.h>
 #include <util/fresh_symbol.h>
 #include <util/invariant.h>
+#include <util/metrics.h>
 #include <util/prefix.h>
 #include <util/range.h>
+#include <util/simplify_expr.h>
+
+#include <goto-programs/remove_returns.h>
 
 #include "expr_skeleton.h"
 #include "symex_assign.h"
@@ -31,6 +36,158 @@ static void locality(
   const goto_functionst::goto_functiont &goto_function,
   const namespacet &ns);
 
+/// \return true if each path through the body of \p goto_function, which
+///   must not contain loops, assigns \p return_value before the end of the
+///   function
+static bool assigns_on_all_paths(
+  const irep_idt &return_value,
+  const goto_functionst::goto_functiont &goto_function)
+{
+  const goto_programt::instructionst &instructions =
+    goto_function.body.instructions;
+
+  // Without loops, the predecessors of an instruction come before it, so a
+  // single pass computes whether the return value is assigned on entry to
+  // each reachable instruction.
+  std::map<goto_programt::const_targett, bool> assigned_on_entry;
+  const auto join = [&](goto_programt::const_targett target, bool assigned) {
+    auto entry = assigned_on_entry.emplace(target, assigned);
+    if(!entry.second)
+      entry.first->second = entry.first->second && assigned;
+  };
+
+  if(instructions.empty())
+    return false;
+  join(instructions.begin(), false);
+
+  for(auto it = instructions.begin(); it != instructions.end(); ++it)
+  {
+    const auto entry = assigned_on_entry.find(it);
+    if(entry == assigned_on_entry.end())
+      continue;
+
+    if(it->is_end_function())
+    {
+      if(!entry->second)
+        return false;
+      continue;
+    }
+
+    const bool assigned =
+      entry->second ||
+      (it->is_assign() && it->get_assign().lhs().id() == ID_symbol &&
+       to_symbol_expr(it->get_assign().lhs()).get_identifier() ==
+         return_value);
+
+    if(it->is_goto())
+    {
+      for(const auto &target : it->targets)
+        join(target, assigned);
+      if(it->get_condition().is_true())
+        continue;
+    }
+
+    join(std::next(it), assigned);
+  }
+
+  return true;
+}
+
+/// A function can be memoized if executing its body has no effect other than
+/// assigning its return value: it has no loops, makes no calls, contains no
+/// properties or assumptions and only reads and writes its parameters and
+/// local variables, none of which have their address taken. A function that
+/// can end without assigning its return value is not memoized either, as the
+/// value it returns would be left over from an earlier call.
+static bool is_memoizable(
+  const irep_idt &function_identifier,
+  const goto_functionst::goto_functiont &goto_function,
+  const namespacet &ns)
+{
+  const irep_idt return_value = return_value_identifier(function_identifier);
+
+  const auto is_impure = [&](const exprt &expr) {
+    if(
+      expr.id() == ID_dereference || expr.id() == ID_address_of ||
+      expr.id() == ID_side_effect)
+    {
+      return true;
+    }
+
+    if(expr.id() != ID_symbol)
+      return false;
+
+    const irep_idt &identifier = to_symbol_expr(expr).get_identifier();
+    if(identifier == return_value)
+      return false;
+
+    const symbolt *symbol;
+    return ns.lookup(identifier, symbol) || symbol->is_static_lifetime;
+  };
+
+  for(const auto &instruction : goto_function.body.instructions)
+  {
+    if(
+      !instruction.is_skip() && !instruction.is_location() &&
+      !instruction.is_end_function() && !instruction.is_decl() &&
+      !instruction.is_dead() && !instruction.is_assign() &&
+      !instruction.is_goto())
+    {
+      return false;
+    }
+
+    if(instruction.is_backwards_goto())
+      return false;
+
+    if(
+      has_subexpr(instruction.code, is_impure) ||
+      has_subexpr(instruction.guard, is_impure))
+    {
+      return false;
+    }
+  }
+
+  const typet &return_type =
+    to_code_type(ns.lookup(function_identifier).type).return_type();
+  return return_type.id() == ID_empty ||
+         assigns_on_all_paths(return_value, goto_function);
+}
+
+/// \return the constant values of the arguments of a call to a memoizable
+///   function, or an empty optional if the call cannot be memoized
+static optionalt<exprt::operandst> memoization_key(
+  path_storaget &path_storage,
+  const irep_idt &function_identifier,
+  const goto_functionst::goto_functiont &goto_function,
+  const std::vector<renamedt<exprt, L2>> &renamed_arguments,
+  const namespacet &ns)
+{
+  if(renamed_arguments.size() != goto_function.parameter_identifiers.size())
+    return {};
+
+  auto entry =
+    path_storage.memoizable_functions.emplace(function_identifier, false);
+  if(entry.second)
+  {
+    entry.first->second =
+      is_memoizable(function_identifier, goto_function, ns);
+  }
+  if(!entry.first->second)
+    return {};
+
+  exprt::operandst key;
+  key.reserve(renamed_arguments.size());
+  for(const auto &argument : renamed_arguments)
+  {
+    exprt value = simplify_expr(argument.get(), ns);
+    if(!value.is_constant())
+      return {};
+    key.push_back(std::move(value));
+  }
+
+  return std::move(key);
+}
+
 bool goto_symext::get_unwind_recursion(const irep_idt &, unsigned, unsigned)
 {
   return false;
@@ -278,6 +435,41 @@ void goto_symext::symex_function_call_code(
   target.function_call(
     state.guard.as_expr(), identifier, renamed_arguments, state.source, hidden);
 
+  optionalt<exprt::operandst> summary_arguments;
+  if(
+    symex_config.memoize_function_calls && call.lhs().is_nil() &&
+    goto_function.body_available())
+  {
+    summary_arguments = memoization_key(
+      path_storage, identifier, goto_function, renamed_arguments, ns);
+  }
+
+  if(summary_arguments)
+  {
+    const auto &summaries = path_storage.function_summaries[identifier];
+    const auto summary = summaries.find(*summary_arguments);
+    get_metrics().add("memoizedCallLookups");
+    if(summary != summaries.end())
+    {
+      get_metrics().add("memoizedCallHits");
+
+      // the body was executed before with the same arguments, only replay
+      // the assignment to its return value
+      target.function_return(
+        state.guard.as_expr(), identifier, state.source, hidden);
+
+      if(summary->second.is_not_nil())
+      {
+        symex_assign(
+          state,
+          code_assignt{return_value_symbol(identifier, ns), summary->second});
+      }
+
+      symex_transition(state);
+      return;
+    }
+  }
+
   if(!goto_function.body_available())
   {
     no_body(identifier);
@@ -339,6 +531,7 @@ void goto_symext::symex_function_call_code(
   frame.return_value=call.lhs();
   frame.function_identifier=identifier;
   frame.hidden_function = callee_is_hidden;
+  frame.summary_arguments = std::move(summary_arguments);
 
   const framet &p_frame = state.call_stack().previous_frame();
   for(const auto &pair : p_frame.loop_iterations)
@@ -429,6 +622,27 @@ void goto_symext::symex_end_of_function(statet &state)
   target.function_return(
     state.guard.as_expr(), state.source.function_id, state.source, hidden);
 
+  // memoize the result if it is a constant
+  const framet &frame = state.call_stack().top();
+  if(frame.summary_arguments)
+  {
+    const irep_idt &identifier = frame.function_identifier;
+    const code_typet &type = to_code_type(ns.lookup(identifier).type);
+
+    exprt result = nil_exprt();
+    if(type.return_type().id() != ID_empty)
+    {
+      result = simplify_expr(
+        state.rename(return_value_symbol(identifier, ns), ns).get(), ns);
+    }
+
+    if(result.is_nil() || result.is_constant())
+    {
+      path_storage.function_summaries[identifier].emplace(
+        *frame.summary_arguments, std::move(result));
+    }
+  }
+
   // then get rid of the frame
   pop_frame(state, path_storage, symex_config.doing_path_exploration);
 }
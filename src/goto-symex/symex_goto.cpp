@@ -342,6 +342,39 @@ void goto_symext::symex_goto(statet &state)
     state_pc=goto_target;
   }
 
+  // When replaying a path read from a checkpoint, continue as if the state
+  // had been saved at this branch point and then resumed. A resumed state
+  // executes this GOTO once more, which e.g. counts another unwinding of a
+  // backward GOTO, so do the same to rebuild the state that was saved.
+  if(
+    symex_config.doing_path_exploration && !state.has_saved_jump_target &&
+    !state.has_saved_next_instruction &&
+    state.taken_path_decisions < state.path_decisions.size())
+  {
+    if(state.path_decisions[state.taken_path_decisions])
+    {
+      state.saved_target = new_state_pc;
+      state.has_saved_jump_target = true;
+    }
+    else
+    {
+      state.saved_target = state_pc;
+      state.has_saved_next_instruction = true;
+    }
+    ++state.taken_path_decisions;
+
+    // as in execute_next_instruction
+    if(symex_config.max_depth != 0 && state.depth > symex_config.max_depth)
+      symex_assume_l2(state, false_exprt());
+    state.depth++;
+
+    if(state.reachable)
+      symex_goto(state);
+    else
+      symex_unreachable_goto(state);
+    return;
+  }
+
   // Normally the next instruction to execute would be state_pc and we save
   // new_state_pc for later. But if we're executing from a saved state, then
   // new_state_pc should be the state that we saved from earlier, so let's
@@ -380,10 +413,14 @@ void goto_symext::symex_goto(statet &state)
     path_storaget::patht next_instruction(target, state);
     next_instruction.state.saved_target = state_pc;
     next_instruction.state.has_saved_next_instruction = true;
+    next_instruction.state.path_decisions.push_back(false);
+    ++next_instruction.state.taken_path_decisions;
 
     path_storaget::patht jump_target(target, state);
     jump_target.state.saved_target = new_state_pc;
     jump_target.state.has_saved_jump_target = true;
+    jump_target.state.path_decisions.push_back(true);
+    ++jump_target.state.taken_path_decisions;
     // `forward` tells us where the branch we're _currently_ executing is
     // pointing to; this needs to be inverted for the branch that we're saving,
     // so let its truth value for `backwards` be the same as ours for `forward`.
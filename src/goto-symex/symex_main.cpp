@@ -15,12 +15,15 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <pointer-analysis/value_set_dereference.h>
 
+#include <util/cprover_prefix.h>
 #include <util/exception_utils.h>
 #include <util/expr_iterator.h>
 #include <util/expr_util.h>
 #include <util/invariant.h>
 #include <util/make_unique.h>
+#include <util/metrics.h>
 #include <util/mathematical_expr.h>
+#include <util/prefix.h>
 #include <util/replace_symbol.h>
 #include <util/std_expr.h>
 #include <util/string2int.h>
@@ -44,6 +47,10 @@ symex_configt::symex_configt(const optionst &options)
     partial_loops(options.get_bool_option("partial-loops")),
     havoc_undefined_functions(
       options.get_bool_option("havoc-undefined-functions")),
+    memoize_function_calls(
+      options.get_bool_option("symex-memoize-calls") &&
+      !options.is_set("paths") &&
+      options.get_unsigned_int_option("depth") == 0),
     debug_level(unsafe_string2int(options.get_option("debug-level"))),
     run_validation_checks(options.get_bool_option("validate-ssa-equation")),
     show_symex_steps(options.get_bool_option("show-goto-symex-steps")),
@@ -54,6 +61,10 @@ symex_configt::symex_configt(const optionst &options)
             ? options.get_unsigned_int_option(
                 "max-field-sensitivity-array-size")
             : DEFAULT_MAX_FIELD_SENSITIVITY_ARRAY_SIZE),
+    sparse_array_field_sensitivity(
+      options.get_bool_option("sparse-array-field-sensitivity") &&
+      !options.is_set("no-array-field-sensitivity")),
+    cone_of_influence(options.get_bool_option("symex-cone-of-influence")),
     complexity_limits_active(
       options.get_signed_int_option("symex-complexity-limit") > 0)
 {
@@ -326,6 +337,8 @@ void goto_symext::symex_with_state(
   const get_goto_functiont &get_goto_function,
   symbol_tablet &new_symbol_table)
 {
+  scoped_metrics_timert timer("symex");
+
   // resets the namespace to only wrap a single symbol table, and does so upon
   // destruction of an object of this type; instantiating the type is thus all
   // that's needed to achieve a reset upon exiting this method
@@ -400,6 +413,99 @@ void goto_symext::resume_symex_from_saved_state(
       new_symbol_table);
 }
 
+/// Collect the functions that symex may execute, i.e., those reachable from
+/// the entry point through direct calls, in the same way as symex obtains
+/// them. Unlike iterating over the symbol table, this is also safe with
+/// symex-driven lazy loading, which converts functions and adds symbols as
+/// they are requested.
+static std::vector<const goto_functionst::goto_functiont *>
+reachable_functions(const goto_symext::get_goto_functiont &get_goto_function)
+{
+  std::vector<const goto_functionst::goto_functiont *> result;
+  std::unordered_set<irep_idt> visited;
+  std::vector<irep_idt> worklist{goto_functionst::entry_point()};
+
+  while(!worklist.empty())
+  {
+    const irep_idt id = worklist.back();
+    worklist.pop_back();
+
+    if(!visited.insert(id).second)
+      continue;
+
+    const goto_functionst::goto_functiont &goto_function =
+      get_goto_function(id);
+    result.push_back(&goto_function);
+
+    for(const auto &instruction : goto_function.body.instructions)
+    {
+      if(!instruction.is_function_call())
+        continue;
+
+      // as in symex_function_call_symbol, function pointers have been
+      // removed and __CPROVER_fkt_ functions have no body
+      const exprt &function = instruction.get_function_call().function();
+      if(
+        function.id() == ID_symbol &&
+        !has_prefix(
+          id2string(to_symbol_expr(function).get_identifier()),
+          CPROVER_FKT_PREFIX))
+      {
+        worklist.push_back(to_symbol_expr(function).get_identifier());
+      }
+    }
+  }
+
+  return result;
+}
+
+/// Collect the constant indices at which arrays too large to be expanded
+/// completely are accessed in any of the \p functions
+static std::shared_ptr<const field_sensitivityt::sparse_array_indicest>
+collect_sparse_array_indices(
+  const std::vector<const goto_functionst::goto_functiont *> &functions,
+  const namespacet &ns,
+  std::size_t max_field_sensitivity_array_size)
+{
+  auto sparse_array_indices =
+    std::make_shared<field_sensitivityt::sparse_array_indicest>();
+
+  for(const auto goto_function : functions)
+  {
+    field_sensitivityt::collect_sparse_array_indices(
+      goto_function->body,
+      ns,
+      max_field_sensitivity_array_size,
+      *sparse_array_indices);
+  }
+
+  return sparse_array_indices;
+}
+
+static std::shared_ptr<const relevant_objectst> collect_relevant_objects(
+  const std::vector<const goto_functionst::goto_functiont *> &functions,
+  const goto_symext::get_goto_functiont &get_goto_function)
+{
+  // all callees are among the reachable functions, which have been obtained
+  // already
+  const relevant_objectst::get_functiont get_function =
+    [&get_goto_function](
+      const irep_idt &id) -> const goto_functionst::goto_functiont * {
+    if(has_prefix(id2string(id), CPROVER_FKT_PREFIX))
+      return nullptr;
+    return &get_goto_function(id);
+  };
+
+  auto relevant_objects = std::make_shared<relevant_objectst>();
+
+  for(const auto goto_function : functions)
+    relevant_objects->add_function(*goto_function, get_function);
+
+  relevant_objects->propagate();
+
+  return relevant_objects;
+}
+
 std::unique_ptr<goto_symext::statet> goto_symext::initialize_entry_point_state(
   const get_goto_functiont &get_goto_function)
 {
@@ -420,11 +526,30 @@ std::unique_ptr<goto_symext::statet> goto_symext::initialize_entry_point_state(
   auto *storage = &path_storage;
 
   // create and prepare the state
+  // the same elements of an array need to be tracked on all paths, hence
+  // determine them up front
+  std::vector<const goto_functionst::goto_functiont *> functions;
+  if(
+    symex_config.sparse_array_field_sensitivity ||
+    (symex_config.cone_of_influence && !path_storage.relevant_objects))
+  {
+    functions = reachable_functions(get_goto_function);
+  }
+
+  std::shared_ptr<const field_sensitivityt::sparse_array_indicest>
+    sparse_array_indices;
+  if(symex_config.sparse_array_field_sensitivity)
+  {
+    sparse_array_indices = collect_sparse_array_indices(
+      functions, ns, symex_config.max_field_sensitivity_array_size);
+  }
+
   auto state = util_make_unique<statet>(
     symex_targett::sourcet(entry_point_id, start_function->body),
     symex_config.max_field_sensitivity_array_size,
     guard_manager,
-    [storage](const irep_idt &id) { return storage->get_unique_l2_index(id); });
+    [storage](const irep_idt &id) { return storage->get_unique_l2_index(id); },
+    std::move(sparse_array_indices));
 
   CHECK_RETURN(!state->threads.empty());
   CHECK_RETURN(!state->call_stack().empty());
@@ -442,6 +567,16 @@ std::unique_ptr<goto_symext::statet> goto_symext::initialize_entry_point_state(
   state->run_validation_checks = symex_config.run_validation_checks;
 
   // initialize support analyses
+  if(symex_config.cone_of_influence && !path_storage.relevant_objects)
+  {
+    path_storage.relevant_objects =
+      collect_relevant_objects(functions, get_goto_function);
+    log.statistics() << "Cone of influence: assignments to "
+                     << path_storage.relevant_objects
+                          ->number_of_irrelevant_objects()
+                     << " objects will be skipped" << messaget::eom;
+  }
+
   auto emplace_safe_pointers_result =
     path_storage.safe_pointers.emplace(entry_point_id, local_safe_pointerst{});
   if(emplace_safe_pointers_result.second)
@@ -489,6 +624,25 @@ void goto_symext::initialize_path_storage_from_entry_point_of(
   path_storage.push(entry_point_start);
 }
 
+void goto_symext::initialize_path_storage_from_checkpoint(
+  const get_goto_functiont &get_goto_function,
+  symbol_tablet &new_symbol_table,
+  const std::vector<path_decisionst> &paths)
+{
+  auto state = initialize_entry_point_state(get_goto_function);
+
+  for(const path_decisionst &decisions : paths)
+  {
+    path_storaget::patht path(target, *state);
+    path.state.saved_target = state->source.pc;
+    path.state.has_saved_next_instruction = true;
+    path.state.path_decisions = decisions;
+    path.state.taken_path_decisions = 0;
+
+    path_storage.push(path);
+  }
+}
+
 goto_symext::get_goto_functiont
 goto_symext::get_goto_function(abstract_goto_modelt &goto_model)
 {
@@ -666,8 +820,14 @@ void goto_symext::execute_next_instruction(
     break;
 
   case ASSIGN:
-    if(state.reachable)
+    if(
+      state.reachable &&
+      (!path_storage.relevant_objects ||
+       !path_storage.relevant_objects->is_irrelevant_assignment(
+         instruction.get_assign().lhs())))
+    {
       symex_assign(state, instruction.get_assign());
+    }
 
     symex_transition(state);
     break;
@@ -138,6 +138,7 @@ class bdd_managert
 public:
   bdd_managert() : cudd()
   {
+    cudd.AutodynEnable(CUDD_REORDER_SIFT);
   }
 
   bdd_managert(const bdd_managert &) = delete;
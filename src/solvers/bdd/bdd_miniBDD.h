@@ -45,7 +45,7 @@ public:
   /// Label on the node, corresponds to the index of a Boolean variable
   indext index() const
   {
-    return bdd_var_to_index.at(node->var);
+    return bdd_var_to_index.at(node->mgr->var_at_level(node->var));
   }
 
   bdd_nodet then_branch() const
@@ -70,7 +70,8 @@ public:
 private:
   mini_bdd_nodet *node;
 
-  // Should be owned by the BDD manager
+  // Should be owned by the BDD manager, maps variable identifiers, which
+  // unlike levels are not affected by reordering, to indexes
   const std::unordered_map<std::size_t, std::size_t> &bdd_var_to_index;
 
   explicit bdd_nodet(
@@ -168,7 +169,7 @@ public:
       return it->second;
     auto var = Var(std::to_string(index));
     auto emplace_result = index_to_bdd.emplace(index, bddt(var));
-    bdd_var_to_index[var.var()] = index;
+    bdd_var_to_index[var_at_level(var.var())] = index;
     return emplace_result.first->second;
   }
 
@@ -49,7 +49,7 @@ int main()
     auto x3 = mgr.Var("x_3");
     auto x4 = mgr.Var("x_4");
     auto tmp = (x1 & x2) | (x3 & x4);
-    result = restrict(tmp, x2.var(), 0);
+    result = restrict(tmp, mgr.var_at_level(x2.var()), 0);
   }
 #else
   {
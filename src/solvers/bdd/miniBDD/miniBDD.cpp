@@ -15,6 +15,8 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <util/invariant.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
 
 #define forall_nodes(it)                                                       \
@@ -39,7 +41,9 @@ void mini_bdd_nodet::remove_reference()
 
 mini_bddt mini_bdd_mgrt::Var(const std::string &label)
 {
-  var_table.push_back(var_table_entryt(label));
+  const unsigned id = var_table.size() + 1;
+  var_table.push_back(var_table_entryt(label, id));
+  var_levels.push_back(var_table.size());
   true_bdd.node->var = var_table.size() + 1;
   false_bdd.node->var = var_table.size() + 1;
   return mk(var_table.size(), false_bdd, true_bdd);
@@ -292,7 +296,16 @@ mini_bddt mini_bdd_applyt::APP_non_rec(const mini_bddt &_x, const mini_bddt &_y)
       }
       else
       {
-        if(x.is_constant() && y.is_constant())
+        // results of earlier operations
+        const mini_bddt cached = x.node->mgr->lookup(fkt, x, y);
+
+        if(cached.is_initialized())
+        {
+          G[t.key] = cached;
+          t.result = cached;
+          stack.pop();
+        }
+        else if(x.is_constant() && y.is_constant())
         {
           bool result_truth = fkt(x.is_true(), y.is_true());
           const mini_bdd_mgrt &mgr = *x.node->mgr;
@@ -351,6 +364,7 @@ mini_bddt mini_bdd_applyt::APP_non_rec(const mini_bddt &_x, const mini_bddt &_y)
       mini_bdd_mgrt *mgr = x.node->mgr;
       t.result = mgr->mk(t.var, t.lr, t.hr);
       G[t.key] = t.result;
+      mgr->insert(fkt, x, y, t.result);
       stack.pop();
     }
     break;
@@ -363,6 +377,16 @@ mini_bddt mini_bdd_applyt::APP_non_rec(const mini_bddt &_x, const mini_bddt &_y)
   return u;
 }
 
+/// Apply \p fkt to \p x and \p y, and reorder the variables afterwards if
+/// the number of nodes has grown too large
+static mini_bddt
+apply(mini_bdd_mgrt::operationt fkt, const mini_bddt &x, const mini_bddt &y)
+{
+  mini_bddt result = mini_bdd_applyt(fkt)(x, y);
+  result.node->mgr->reorder_if_needed();
+  return result;
+}
+
 bool equal_fkt(bool x, bool y)
 {
   return x == y;
@@ -370,7 +394,7 @@ bool equal_fkt(bool x, bool y)
 
 mini_bddt mini_bddt::operator==(const mini_bddt &other) const
 {
-  return mini_bdd_applyt(equal_fkt)(*this, other);
+  return apply(equal_fkt, *this, other);
 }
 
 bool xor_fkt(bool x, bool y)
@@ -380,7 +404,7 @@ bool xor_fkt(bool x, bool y)
 
 mini_bddt mini_bddt::operator^(const mini_bddt &other) const
 {
-  return mini_bdd_applyt(xor_fkt)(*this, other);
+  return apply(xor_fkt, *this, other);
 }
 
 mini_bddt mini_bddt::operator!() const
@@ -397,7 +421,7 @@ bool and_fkt(bool x, bool y)
 
 mini_bddt mini_bddt::operator&(const mini_bddt &other) const
 {
-  return mini_bdd_applyt(and_fkt)(*this, other);
+  return apply(and_fkt, *this, other);
 }
 
 bool or_fkt(bool x, bool y)
@@ -407,7 +431,7 @@ bool or_fkt(bool x, bool y)
 
 mini_bddt mini_bddt::operator|(const mini_bddt &other) const
 {
-  return mini_bdd_applyt(or_fkt)(*this, other);
+  return apply(or_fkt, *this, other);
 }
 
 mini_bdd_mgrt::mini_bdd_mgrt()
@@ -485,6 +509,228 @@ operator<(const mini_bdd_mgrt::reverse_keyt &y) const
     return x.high < y.high;
 }
 
+/// Number of entries of the computed table, a power of two
+static const std::size_t computed_table_size = std::size_t(1) << 16;
+
+std::size_t mini_bdd_mgrt::computed_table_index(
+  operationt operation,
+  const mini_bddt &x,
+  const mini_bddt &y) const
+{
+  std::size_t hash = reinterpret_cast<std::uintptr_t>(operation);
+  hash = hash * 31 + x.node_number();
+  hash = hash * 31 + y.node_number();
+  return (hash ^ (hash >> 16)) & (computed_table_size - 1);
+}
+
+mini_bddt mini_bdd_mgrt::lookup(
+  operationt operation,
+  const mini_bddt &x,
+  const mini_bddt &y) const
+{
+  if(computed_table.empty())
+    return mini_bddt();
+
+  const computed_entryt &entry =
+    computed_table[computed_table_index(operation, x, y)];
+
+  // the entry holds references to its operands, hence their node numbers
+  // cannot have been reused for different nodes
+  if(
+    entry.operation == operation && entry.x.node == x.node &&
+    entry.y.node == y.node)
+  {
+    return entry.result;
+  }
+
+  return mini_bddt();
+}
+
+void mini_bdd_mgrt::insert(
+  operationt operation,
+  const mini_bddt &x,
+  const mini_bddt &y,
+  const mini_bddt &result)
+{
+  if(computed_table.empty())
+    computed_table.resize(computed_table_size);
+
+  computed_entryt &entry =
+    computed_table[computed_table_index(operation, x, y)];
+  entry.operation = operation;
+  entry.x = x;
+  entry.y = y;
+  entry.result = result;
+}
+
+void mini_bdd_mgrt::clear_computed_table()
+{
+  computed_table.clear();
+}
+
+void mini_bdd_mgrt::swap_levels(unsigned level)
+{
+  PRECONDITION_WITH_DIAGNOSTICS(
+    level >= 1 && level < var_table.size(),
+    "only existing adjacent levels can be swapped");
+
+  const unsigned upper = level;
+  const unsigned lower = level + 1;
+
+  std::vector<mini_bdd_nodet *> upper_nodes, lower_nodes;
+
+  for(auto &n : nodes)
+  {
+    if(n.reference_counter == 0 || n.node_number <= 1)
+      continue;
+    if(n.var == upper)
+      upper_nodes.push_back(&n);
+    else if(n.var == lower)
+      lower_nodes.push_back(&n);
+  }
+
+  for(const auto n : upper_nodes)
+    reverse_map.erase(reverse_keyt(n->var, n->low, n->high));
+  for(const auto n : lower_nodes)
+    reverse_map.erase(reverse_keyt(n->var, n->low, n->high));
+
+  // the nodes of the lower variable move up unchanged
+  for(const auto n : lower_nodes)
+  {
+    n->var = upper;
+    reverse_map[reverse_keyt(n->var, n->low, n->high)] = n;
+  }
+
+  // the nodes of the upper variable that do not depend on the lower variable
+  // move down unchanged
+  std::vector<mini_bdd_nodet *> interacting;
+  for(const auto n : upper_nodes)
+  {
+    if(n->low.var() == upper || n->high.var() == upper)
+      interacting.push_back(n);
+    else
+    {
+      n->var = lower;
+      reverse_map[reverse_keyt(n->var, n->low, n->high)] = n;
+    }
+  }
+
+  // the remaining ones are rewritten in place as a decision on the variable
+  // that moved up, so that all references to them remain valid
+  for(const auto n : interacting)
+  {
+    const mini_bddt f00 = n->low.var() == upper ? n->low.low() : n->low;
+    const mini_bddt f01 = n->low.var() == upper ? n->low.high() : n->low;
+    const mini_bddt f10 = n->high.var() == upper ? n->high.low() : n->high;
+    const mini_bddt f11 = n->high.var() == upper ? n->high.high() : n->high;
+
+    const mini_bddt new_low = mk(lower, f00, f10);
+    const mini_bddt new_high = mk(lower, f01, f11);
+
+    n->var = upper;
+    n->low = new_low;
+    n->high = new_high;
+    reverse_map[reverse_keyt(n->var, n->low, n->high)] = n;
+  }
+
+  std::swap(var_table[upper - 1], var_table[lower - 1]);
+  var_levels[var_table[upper - 1].id - 1] = upper;
+  var_levels[var_table[lower - 1].id - 1] = lower;
+}
+
+std::size_t mini_bdd_mgrt::sift(unsigned level, std::size_t max_swaps)
+{
+  // stop moving in one direction once the size grows beyond this factor
+  const double max_growth = 1.2;
+
+  std::size_t best_size = number_of_nodes();
+  unsigned best_level = level;
+  std::size_t swaps = 0;
+
+  const auto update_best = [&]() {
+    if(number_of_nodes() < best_size)
+    {
+      best_size = number_of_nodes();
+      best_level = level;
+    }
+  };
+
+  while(level < var_table.size() && swaps < max_swaps)
+  {
+    swap_levels(level);
+    ++level;
+    ++swaps;
+    update_best();
+    if(number_of_nodes() > max_growth * best_size)
+      break;
+  }
+
+  while(level > 1 && swaps < max_swaps)
+  {
+    swap_levels(level - 1);
+    --level;
+    ++swaps;
+    update_best();
+    if(number_of_nodes() > max_growth * best_size && level < best_level)
+      break;
+  }
+
+  // moving to the best level is not limited by the budget
+  for(; level < best_level; ++level, ++swaps)
+    swap_levels(level);
+  for(; level > best_level; --level, ++swaps)
+    swap_levels(level - 1);
+
+  return swaps;
+}
+
+void mini_bdd_mgrt::reorder()
+{
+  // nodes only referenced by the computed table would distort the sizes
+  clear_computed_table();
+
+  if(var_table.size() < 2)
+    return;
+
+  // sift the variables with the most nodes first
+  std::vector<std::size_t> nodes_per_id(var_table.size() + 1, 0);
+  for(const auto &n : nodes)
+  {
+    if(n.reference_counter != 0 && n.node_number >= 2)
+      ++nodes_per_id[var_at_level(n.var)];
+  }
+
+  std::vector<unsigned> ids;
+  for(const auto &entry : var_table)
+    ids.push_back(entry.id);
+  std::stable_sort(ids.begin(), ids.end(), [&](unsigned a, unsigned b) {
+    return nodes_per_id[a] > nodes_per_id[b];
+  });
+
+  // each swap visits all nodes, hence bound the effort
+  const std::size_t max_vars = 100;
+  std::size_t swaps_left = 10000;
+
+  for(std::size_t i = 0; i < ids.size() && i < max_vars && swaps_left > 0; ++i)
+  {
+    unsigned level = 1;
+    while(var_at_level(level) != ids[i])
+      ++level;
+
+    const std::size_t swaps = sift(level, swaps_left);
+    swaps_left -= std::min(swaps, swaps_left);
+  }
+}
+
+void mini_bdd_mgrt::reorder_if_needed()
+{
+  if(!auto_reorder || number_of_nodes() < reorder_threshold)
+    return;
+
+  reorder();
+  reorder_threshold = std::max(reorder_threshold, 2 * number_of_nodes());
+}
+
 void mini_bdd_mgrt::DumpTable(std::ostream &out) const
 {
   out << "\\# & \\mathit{var} & \\mathit{low} &"
@@ -513,6 +759,8 @@ void mini_bdd_mgrt::DumpTable(std::ostream &out) const
 class restrictt
 {
 public:
+  /// \param _var: level of the variable to restrict
+  /// \param _value: value the variable is replaced by
   inline restrictt(const unsigned _var, const bool _value)
     : var(_var), value(_value)
   {
@@ -553,7 +801,11 @@ mini_bddt restrictt::RES(const mini_bddt &u)
 
 mini_bddt restrict(const mini_bddt &u, unsigned var, const bool value)
 {
-  return restrictt(var, value)(u);
+  PRECONDITION_WITH_DIAGNOSTICS(
+    u.is_initialized(),
+    "restricting variables can only be done in initialized BDDs");
+  // the level is looked up on each call, as operations may reorder
+  return restrictt(u.node->mgr->level_of_var(var), value)(u);
 }
 
 mini_bddt exists(const mini_bddt &u, const unsigned var)
@@ -619,10 +871,11 @@ bool OneSat(const mini_bddt &v, std::map<unsigned, bool> &assignment)
     return false;
   else
   {
-    assignment[v.var()] = true;
+    const unsigned id = v.node->mgr->var_at_level(v.var());
+    assignment[id] = true;
     if(OneSat(v.high(), assignment))
       return true;
-    assignment[v.var()] = false;
+    assignment[id] = false;
     return OneSat(v.low(), assignment);
   }
 }
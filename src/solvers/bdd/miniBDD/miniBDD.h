@@ -108,10 +108,53 @@ public:
 
   std::size_t number_of_nodes();
 
+  /// A binary Boolean operator applied to BDDs
+  typedef bool (*operationt)(bool, bool);
+
+  /// \return the result of applying \p operation to \p x and \p y if it is
+  ///   in the computed table, an uninitialized BDD otherwise
+  mini_bddt
+  lookup(operationt operation, const mini_bddt &x, const mini_bddt &y) const;
+
+  /// Store the \p result of applying \p operation to \p x and \p y in the
+  /// computed table, replacing any entry with the same hash
+  void insert(
+    operationt operation,
+    const mini_bddt &x,
+    const mini_bddt &y,
+    const mini_bddt &result);
+
+  /// Drop all entries of the computed table, which releases the nodes that are
+  /// only kept alive by it
+  void clear_computed_table();
+
+  /// Reorder the variables by sifting: each variable in turn is moved through
+  /// all levels and left where the total number of nodes is smallest. Nodes
+  /// are rewritten in place, hence existing BDDs remain valid, but the level
+  /// returned by \ref mini_bddt::var may change.
+  void reorder();
+
+  /// Reorder if the number of nodes exceeds a threshold, which is then raised
+  /// to twice the number of nodes left after reordering. This is called after
+  /// each operation on BDDs if \ref auto_reorder is set.
+  void reorder_if_needed();
+
+  /// Reorder automatically once the number of nodes grows large
+  bool auto_reorder = true;
+
+  /// \return identifier of the variable at \p level; unlike the level, this
+  ///   does not change when variables are reordered
+  unsigned var_at_level(unsigned level) const;
+
+  /// \return level of the variable with identifier \p id in the current order
+  unsigned level_of_var(unsigned id) const;
+
   struct var_table_entryt
   {
     std::string label;
-    explicit var_table_entryt(const std::string &_label);
+    /// Position of the variable in the order of creation
+    unsigned id;
+    var_table_entryt(const std::string &_label, unsigned _id);
   };
 
   typedef std::vector<var_table_entryt> var_tablet;
@@ -122,6 +165,10 @@ protected:
   nodest nodes;
   mini_bddt true_bdd, false_bdd;
 
+  /// Level of each variable, indexed by its identifier minus one; the inverse
+  /// of \ref var_at_level
+  std::vector<unsigned> var_levels;
+
   // this is our reverse-map for nodes
   struct reverse_keyt
   {
@@ -136,13 +183,41 @@ protected:
 
   typedef std::stack<mini_bdd_nodet *> freet;
   freet free;
+
+  /// Direct-mapped cache of the results of operations, shared between all
+  /// operations so that results are reused across calls
+  struct computed_entryt
+  {
+    operationt operation = nullptr;
+    mini_bddt x, y, result;
+  };
+
+  // declared after the node storage, as the entries hold references to nodes
+  std::vector<computed_entryt> computed_table;
+
+  std::size_t reorder_threshold = 4096;
+
+  std::size_t computed_table_index(
+    operationt operation,
+    const mini_bddt &x,
+    const mini_bddt &y) const;
+
+  /// Exchange the variable at \p level with the one at \p level + 1
+  void swap_levels(unsigned level);
+
+  /// Move the variable at \p level to the level where the number of nodes is
+  /// smallest, \return the number of swaps done
+  std::size_t sift(unsigned level, std::size_t max_swaps);
 };
 
+// Variables are passed by their identifier, see mini_bdd_mgrt::var_at_level,
+// as their level changes when the variables are reordered.
 mini_bddt restrict(const mini_bddt &u, unsigned var, const bool value);
 mini_bddt exists(const mini_bddt &u, unsigned var);
 mini_bddt
 substitute(const mini_bddt &where, unsigned var, const mini_bddt &by_what);
 std::string cubes(const mini_bddt &u);
+/// Find a satisfying assignment of \p v, keyed by variable identifier
 bool OneSat(const mini_bddt &v, std::map<unsigned, bool> &assignment);
 
 // inline functions
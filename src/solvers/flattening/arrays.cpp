@@ -241,6 +241,8 @@ void arrayst::collect_arrays(const exprt &a)
 /// adds array constraints (refine=true...lazily for the refinement loop)
 void arrayst::add_array_constraint(const lazy_constraintt &lazy, bool refine)
 {
+  ++array_constraint_count[lazy.type];
+
   if(lazy_arrays && refine)
   {
     // lazily add the constraint
@@ -312,6 +314,39 @@ void arrayst::add_array_constraints()
 
   // add the Ackermann constraints
   add_array_Ackermann_constraints();
+
+  display_array_constraint_count();
+}
+
+void arrayst::display_array_constraint_count()
+{
+  if(array_constraint_count.empty())
+    return;
+
+  static const std::map<lazy_typet, std::string> kind_names = {
+    {lazy_typet::ARRAY_ACKERMANN, "Ackermann"},
+    {lazy_typet::ARRAY_WITH, "with"},
+    {lazy_typet::ARRAY_IF, "if"},
+    {lazy_typet::ARRAY_OF, "array_of"},
+    {lazy_typet::ARRAY_TYPECAST, "typecast"},
+    {lazy_typet::ARRAY_CONSTANT, "constant"},
+    {lazy_typet::ARRAY_COMPREHENSION, "comprehension"}};
+
+  log.statistics() << "Array constraints:";
+  for(const auto &count : array_constraint_count)
+    log.statistics() << ' ' << kind_names.at(count.first) << '='
+                     << count.second;
+  log.statistics() << messaget::eom;
+}
+
+/// \return true if the elements of \p array are all defined in terms of the
+///   elements of other arrays in its equivalence class at the same index (or
+///   do not depend on any array), in which case functional consistency of
+///   \p array follows from that of the other arrays
+bool arrayst::is_determined_by_class(const exprt &array)
+{
+  return array.id() == ID_if || array.id() == ID_array_of ||
+         array.id() == ID_typecast || array.id() == ID_array_comprehension;
 }
 
 void arrayst::add_array_Ackermann_constraints()
@@ -325,7 +360,15 @@ void arrayst::add_array_Ackermann_constraints()
   // iterate over arrays
   for(std::size_t i=0; i<arrays.size(); i++)
   {
-    const index_sett &index_set=index_map[arrays.find_number(i)];
+    // add_array_constraints has generated the if/array_of/... constraints of
+    // every class for its final index set, as classes that gained indices
+    // were processed again, so these arrays need no Ackermann constraints
+    if(is_determined_by_class(arrays[i]))
+      continue;
+
+    const std::size_t root = arrays.find_number(i);
+
+    const index_sett &index_set=index_map[root];
 
 #ifdef DEBUG
     std::cout << "index_set.size(): " << index_set.size() << '\n';
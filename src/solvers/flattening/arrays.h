@@ -107,9 +107,14 @@ protected:
   void add_array_constraint(const lazy_constraintt &lazy, bool refine = true);
   std::map<exprt, bool> expr_map;
 
+  // number of constraints generated, by kind
+  std::map<lazy_typet, std::size_t> array_constraint_count;
+  void display_array_constraint_count();
+
   // adds all the constraints eagerly
   void add_array_constraints();
   void add_array_Ackermann_constraints();
+  static bool is_determined_by_class(const exprt &array);
   void add_array_constraints_equality(
     const index_sett &index_set, const array_equalityt &array_equality);
   void add_array_constraints(
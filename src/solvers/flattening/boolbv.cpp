@@ -517,6 +517,7 @@ literalt boolbvt::convert_rest(const exprt &expr)
     if(op.type().id() == ID_floatbv)
     {
       float_utilst float_utils(prop, to_floatbv_type(op.type()));
+      float_utils.set_cache(float_utils_cache);
       return float_utils.is_NaN(bv);
     }
     else if(op.type().id() == ID_fixedbv)
@@ -530,9 +531,8 @@ literalt boolbvt::convert_rest(const exprt &expr)
     if(op.type().id() == ID_floatbv)
     {
       float_utilst float_utils(prop, to_floatbv_type(op.type()));
-      return prop.land(
-        !float_utils.is_infinity(bv),
-        !float_utils.is_NaN(bv));
+      float_utils.set_cache(float_utils_cache);
+      return float_utils.is_finite(bv);
     }
     else if(op.id() == ID_fixedbv)
       return const_literal(true);
@@ -545,6 +545,7 @@ literalt boolbvt::convert_rest(const exprt &expr)
     if(op.type().id() == ID_floatbv)
     {
       float_utilst float_utils(prop, to_floatbv_type(op.type()));
+      float_utils.set_cache(float_utils_cache);
       return float_utils.is_infinity(bv);
     }
     else if(op.type().id() == ID_fixedbv)
@@ -558,6 +559,7 @@ literalt boolbvt::convert_rest(const exprt &expr)
     {
       const bvt &bv = convert_bv(op);
       float_utilst float_utils(prop, to_floatbv_type(op.type()));
+      float_utils.set_cache(float_utils_cache);
       return float_utils.is_normal(bv);
     }
     else if(op.type().id() == ID_fixedbv)
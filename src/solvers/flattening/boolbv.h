@@ -19,6 +19,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/mp_arith.h>
 #include <util/optional.h>
 
+#include <solvers/floatbv/float_utils.h>
 #include <solvers/lowering/functions.h>
 
 #include "bv_utils.h"
@@ -62,6 +63,7 @@ public:
   {
     SUB::clear_cache();
     bv_cache.clear();
+    float_utils_cache.clear();
   }
 
   void post_process() override
@@ -120,6 +122,9 @@ protected:
   typedef std::unordered_map<const exprt, bvt, irep_hash> bv_cachet;
   bv_cachet bv_cache;
 
+  // floating-point circuits, shared across all float_utilst instances
+  float_utils_cachet float_utils_cache;
+
   bool type_conversion(
     const typet &src_type, const bvt &src,
     const typet &dest_type, bvt &dest);
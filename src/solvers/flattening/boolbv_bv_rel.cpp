@@ -35,6 +35,7 @@ literalt boolbvt::convert_bv_rel(const binary_relation_exprt &expr)
     if(bvtype_lhs == bvtypet::IS_FLOAT)
     {
       float_utilst float_utils(prop, to_floatbv_type(lhs.type()));
+      float_utils.set_cache(float_utils_cache);
 
       if(rel == ID_le)
         return float_utils.relation(bv_lhs, float_utilst::relt::LE, bv_rhs);
@@ -95,6 +95,7 @@ bvt boolbvt::convert_floatbv_op(const ieee_float_op_exprt &expr)
     irep_pretty_diagnosticst{expr});
 
   float_utilst float_utils(prop);
+  float_utils.set_cache(float_utils_cache);
 
   float_utils.set_rounding_mode(rounding_mode_as_bv);
 
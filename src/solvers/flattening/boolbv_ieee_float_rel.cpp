@@ -34,6 +34,7 @@ literalt boolbvt::convert_ieee_float_rel(const binary_relation_exprt &expr)
        bvtype0==bvtypet::IS_FLOAT && bvtype1==bvtypet::IS_FLOAT)
     {
       float_utilst float_utils(prop, to_floatbv_type(op0.type()));
+      float_utils.set_cache(float_utils_cache);
 
       if(rel==ID_ieee_float_equal)
         return float_utils.relation(bv0, float_utilst::relt::EQ, bv1);
@@ -733,49 +733,87 @@ void bv_pointerst::add_addr(const exprt &expr, bvt &bv)
   encode(a, bv);
 }
 
-void bv_pointerst::do_postponed(
-  const postponedt &postponed)
+std::vector<std::size_t>
+bv_pointerst::feasible_objects(const bvt &object_bv) const
 {
-  if(postponed.expr.id() == ID_is_dynamic_object)
+  PRECONDITION(object_bv.size() == object_bits);
+
+  std::vector<std::size_t> result;
+  const std::size_t number_of_objects = pointer_logic.objects.size();
+  result.reserve(number_of_objects);
+
+  for(std::size_t number = 0; number < number_of_objects; ++number)
   {
-    const auto &objects = pointer_logic.objects;
-    std::size_t number=0;
+    bool feasible = true;
 
-    for(auto it = objects.cbegin(); it != objects.cend(); ++it, ++number)
+    for(std::size_t i = 0; feasible && i < object_bits; i++)
     {
-      const exprt &expr=*it;
+      if(object_bv[i].is_constant())
+      {
+        const bool bit = (number & (std::size_t(1) << i)) != 0;
+        feasible = object_bv[i].is_true() == bit;
+      }
+    }
 
-      bool is_dynamic=pointer_logic.is_dynamic_object(expr);
+    if(feasible)
+      result.push_back(number);
+  }
 
-      // only compare object part
-      bvt bv;
-      encode(number, bv);
+  return result;
+}
+
+void bv_pointerst::do_postponed(
+  const postponedt &postponed)
+{
+  // only compare object part
+  bvt saved_bv = postponed.op;
+  saved_bv.erase(saved_bv.begin(), saved_bv.begin() + offset_bits);
 
-      bv.erase(bv.begin(), bv.begin()+offset_bits);
+  // Objects that the pointer cannot point to, judging from the constant
+  // bits of its encoding, need no constraints. The remaining objects are
+  // grouped by the value they imply, which needs just one implication per
+  // group.
+  const auto &objects = pointer_logic.objects;
 
-      bvt saved_bv=postponed.op;
-      saved_bv.erase(saved_bv.begin(), saved_bv.begin()+offset_bits);
+  const auto object_equal = [&](std::size_t number) {
+    bvt bv;
+    encode(number, bv);
+    bv.erase(bv.begin(), bv.begin() + offset_bits);
 
-      POSTCONDITION(bv.size()==saved_bv.size());
-      PRECONDITION(postponed.bv.size()==1);
+    POSTCONDITION(bv.size() == saved_bv.size());
+    return bv_utils.equal(bv, saved_bv);
+  };
 
-      literalt l1=bv_utils.equal(bv, saved_bv);
-      literalt l2=postponed.bv.front();
+  if(postponed.expr.id() == ID_is_dynamic_object)
+  {
+    PRECONDITION(postponed.bv.size()==1);
 
-      if(!is_dynamic)
-        l2=!l2;
+    bvt dynamic, not_dynamic;
 
-      prop.l_set_to_true(prop.limplies(l1, l2));
+    for(const std::size_t number : feasible_objects(saved_bv))
+    {
+      if(pointer_logic.is_dynamic_object(objects[number]))
+        dynamic.push_back(object_equal(number));
+      else
+        not_dynamic.push_back(object_equal(number));
     }
+
+    const literalt l2 = postponed.bv.front();
+
+    if(!dynamic.empty())
+      prop.l_set_to_true(prop.limplies(prop.lor(dynamic), l2));
+    if(!not_dynamic.empty())
+      prop.l_set_to_true(prop.limplies(prop.lor(not_dynamic), !l2));
   }
   else if(postponed.expr.id()==ID_object_size)
   {
-    const auto &objects = pointer_logic.objects;
-    std::size_t number=0;
+    PRECONDITION(postponed.bv.size()>=1);
+
+    std::map<exprt, bvt> objects_by_size;
 
-    for(auto it = objects.cbegin(); it != objects.cend(); ++it, ++number)
+    for(const std::size_t number : feasible_objects(saved_bv))
     {
-      const exprt &expr=*it;
+      const exprt &expr = objects[number];
 
       if(expr.id() != ID_symbol && expr.id() != ID_string_constant)
         continue;
@@ -788,22 +826,16 @@ void bv_pointerst::do_postponed(
       const exprt object_size = typecast_exprt::conditional_cast(
         size_expr.value(), postponed.expr.type());
 
-      // only compare object part
-      bvt bv;
-      encode(number, bv);
-
-      bv.erase(bv.begin(), bv.begin()+offset_bits);
-
-      bvt saved_bv=postponed.op;
-      saved_bv.erase(saved_bv.begin(), saved_bv.begin()+offset_bits);
+      objects_by_size[object_size].push_back(object_equal(number));
+    }
 
-      bvt size_bv = convert_bv(object_size);
+    for(const auto &size_entry : objects_by_size)
+    {
+      bvt size_bv = convert_bv(size_entry.first);
 
-      POSTCONDITION(bv.size()==saved_bv.size());
-      PRECONDITION(postponed.bv.size()>=1);
       PRECONDITION(size_bv.size() == postponed.bv.size());
 
-      literalt l1=bv_utils.equal(bv, saved_bv);
+      literalt l1 = prop.lor(size_entry.second);
       literalt l2=bv_utils.equal(postponed.bv, size_bv);
 
       prop.l_set_to_true(prop.limplies(l1, l2));
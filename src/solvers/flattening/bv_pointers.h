@@ -68,6 +68,10 @@ protected:
   postponed_listt postponed_list;
 
   void do_postponed(const postponedt &postponed);
+
+  /// Object numbers that the object bits \p object_bv of a pointer may
+  /// encode, i.e., those that do not contradict any of its constant bits
+  std::vector<std::size_t> feasible_objects(const bvt &object_bv) const;
 };
 
 #endif // CPROVER_SOLVERS_FLATTENING_BV_POINTERS_H
@@ -216,6 +216,12 @@ bvt float_utilst::conversion(
   }
 }
 
+literalt float_utilst::is_finite(const bvt &src)
+{
+  // infinity and NaN are exactly the values with all exponent bits set
+  return !exponent_all_ones(src);
+}
+
 literalt float_utilst::is_normal(const bvt &src)
 {
   return prop.land(
@@ -245,6 +251,13 @@ bvt float_utilst::add_sub(
   const bvt &src2,
   bool subtract)
 {
+  const auto key = cache_key(
+    subtract ? float_utils_cachet::opt::SUB : float_utils_cachet::opt::ADD,
+    src1,
+    src2);
+  if(const bvt *cached = cache_lookup(key))
+    return *cached;
+
   unbiased_floatt unpacked1=unpack(src1);
   unbiased_floatt unpacked2=unpack(src2);
 
@@ -345,10 +358,15 @@ bvt float_utilst::add_sub(
     prop.lselect(unpacked1.infinity, unpacked1.sign, unpacked2.sign);
 
   #if 1
+  // x-x is -0 only when rounding towards minus infinity; avoid building the
+  // disjunction when the rounding mode is known not to be that one
   literalt zero_sign=
-    prop.lselect(rounding_mode_bits.round_to_minus_inf,
-                 prop.lor(unpacked1.sign, unpacked2.sign),
-                 prop.land(unpacked1.sign, unpacked2.sign));
+    rounding_mode_bits.round_to_minus_inf.is_false()
+      ? prop.land(unpacked1.sign, unpacked2.sign)
+      : prop.lselect(
+          rounding_mode_bits.round_to_minus_inf,
+          prop.lor(unpacked1.sign, unpacked2.sign),
+          prop.land(unpacked1.sign, unpacked2.sign));
 
   result.sign=prop.lselect(
     result.infinity,
@@ -378,7 +396,7 @@ bvt float_utilst::add_sub(
   return pack(bias(result));
   #endif
 
-  return rounder(result);
+  return cache_insert(key, rounder(result));
 }
 
 /// Limits the shift distance
@@ -407,6 +425,10 @@ bvt float_utilst::limit_distance(
 
 bvt float_utilst::mul(const bvt &src1, const bvt &src2)
 {
+  const auto key = cache_key(float_utils_cachet::opt::MUL, src1, src2);
+  if(const bvt *cached = cache_lookup(key))
+    return *cached;
+
   // unpack
   const unbiased_floatt unpacked1=unpack(src1);
   const unbiased_floatt unpacked2=unpack(src2);
@@ -444,8 +466,8 @@ bvt float_utilst::mul(const bvt &src1, const bvt &src2)
   {
     bvt NaN_cond;
 
-    NaN_cond.push_back(is_NaN(src1));
-    NaN_cond.push_back(is_NaN(src2));
+    NaN_cond.push_back(unpacked1.NaN);
+    NaN_cond.push_back(unpacked2.NaN);
 
     // infinity * 0 is NaN!
     NaN_cond.push_back(prop.land(unpacked1.zero, unpacked2.infinity));
@@ -454,11 +476,15 @@ bvt float_utilst::mul(const bvt &src1, const bvt &src2)
     result.NaN=prop.lor(NaN_cond);
   }
 
-  return rounder(result);
+  return cache_insert(key, rounder(result));
 }
 
 bvt float_utilst::div(const bvt &src1, const bvt &src2)
 {
+  const auto key = cache_key(float_utils_cachet::opt::DIV, src1, src2);
+  if(const bvt *cached = cache_lookup(key))
+    return *cached;
+
   // unpack
   const unbiased_floatt unpacked1=unpack(src1);
   const unbiased_floatt unpacked2=unpack(src2);
@@ -533,7 +559,7 @@ bvt float_utilst::div(const bvt &src1, const bvt &src2)
   result.fraction=bv_utils.select(force_zero,
     bv_utils.zeros(result.fraction.size()), result.fraction);
 
-  return rounder(result);
+  return cache_insert(key, rounder(result));
 }
 
 bvt float_utilst::rem(const bvt &src1, const bvt &src2)
@@ -587,11 +613,11 @@ literalt float_utilst::relation(
 
   // NaN compares to nothing
   literalt is_NaN1=is_NaN(src1);
-  literalt is_NaN2=is_NaN(src2);
-  literalt NaN=prop.lor(is_NaN1, is_NaN2);
 
   if(rel==relt::LT || rel==relt::LE)
   {
+    literalt NaN = prop.lor(is_NaN1, is_NaN(src2));
+
     literalt bitwise_equal=bv_utils.equal(src1, src2);
 
     // signs different? trivial! Unless Zero.
@@ -639,9 +665,9 @@ literalt float_utilst::relation(
   {
     literalt bitwise_equal=bv_utils.equal(src1, src2);
 
-    return prop.land(
-      prop.lor(bitwise_equal, both_zero),
-      !NaN);
+    // bit-wise equal operands are either both NaN or both not NaN, and
+    // zeros are never NaN, so testing one operand for NaN suffices
+    return prop.lor(prop.land(bitwise_equal, !is_NaN1), both_zero);
   }
 
   // not reached
@@ -703,6 +729,11 @@ literalt float_utilst::is_NaN(const bvt &src)
 
 literalt float_utilst::exponent_all_ones(const bvt &src)
 {
+  const auto key =
+    cache_key(float_utils_cachet::opt::EXPONENT_ALL_ONES, src, bvt());
+  if(const bvt *cached = cache_lookup(key))
+    return cached->front();
+
   bvt exponent=src;
 
   // removes the fractional part
@@ -711,7 +742,7 @@ literalt float_utilst::exponent_all_ones(const bvt &src)
   // removes the sign
   exponent.resize(spec.e);
 
-  return bv_utils.is_all_ones(exponent);
+  return cache_insert(key, {bv_utils.is_all_ones(exponent)}).front();
 }
 
 literalt float_utilst::exponent_all_zeros(const bvt &src)
@@ -730,10 +761,16 @@ literalt float_utilst::exponent_all_zeros(const bvt &src)
 literalt float_utilst::fraction_all_zeros(const bvt &src)
 {
   PRECONDITION(src.size() == spec.width());
+
+  const auto key =
+    cache_key(float_utils_cachet::opt::FRACTION_ALL_ZEROS, src, bvt());
+  if(const bvt *cached = cache_lookup(key))
+    return cached->front();
+
   // does not include hidden bit
   bvt tmp=src;
   tmp.resize(spec.f);
-  return bv_utils.is_zero(tmp);
+  return cache_insert(key, {bv_utils.is_zero(tmp)}).front();
 }
 
 /// normalize fraction/exponent pair returns 'zero' if fraction is zero
@@ -968,6 +1005,11 @@ literalt float_utilst::fraction_rounding_decision(
     prop.land(rounding_bit,
               prop.lor(rounding_least, sticky_bit));
 
+  // with the rounding mode fixed to round-to-nearest-even, which is by far
+  // the most common case, the other decisions are dead logic
+  if(rounding_mode_bits.round_to_even.is_true())
+    return round_to_even;
+
   // round up
   literalt round_to_plus_inf=
     prop.land(!sign,
@@ -1222,9 +1264,12 @@ float_utilst::unbiased_floatt float_utilst::unpack(const bvt &src)
       bv_utils.build_constant(-spec.bias()+1, spec.e),
       sub_bias(result.exponent));
 
-  result.infinity=is_infinity(src);
+  // infinity and NaN share the exponent and fraction tests
+  const literalt all_ones = exponent_all_ones(src);
+  const literalt fraction_zero = fraction_all_zeros(src);
+  result.infinity = prop.land(all_ones, fraction_zero);
   result.zero=is_zero(src);
-  result.NaN=is_NaN(src);
+  result.NaN = prop.land(all_ones, !fraction_zero);
 
   return result;
 }
@@ -1322,3 +1367,53 @@ bvt float_utilst::debug2(
 {
   return op0;
 }
+
+float_utils_cachet::keyt float_utilst::cache_key(
+  float_utils_cachet::opt op,
+  const bvt &src1,
+  const bvt &src2) const
+{
+  // classification does not depend on the rounding mode
+  const bool uses_rounding_mode =
+    op != float_utils_cachet::opt::EXPONENT_ALL_ONES &&
+    op != float_utils_cachet::opt::FRACTION_ALL_ZEROS;
+  const rounding_mode_bitst &rm =
+    uses_rounding_mode ? rounding_mode_bits : rounding_mode_bitst();
+
+  return float_utils_cachet::keyt{op,
+                                  spec.f,
+                                  spec.e,
+                                  spec.x86_extended,
+                                  rm.round_to_even,
+                                  rm.round_to_zero,
+                                  rm.round_to_plus_inf,
+                                  rm.round_to_minus_inf,
+                                  src1,
+                                  src2};
+}
+
+/// \return the circuit stored for \p key, or nullptr if there is no cache
+///   or it does not have an entry for \p key
+const bvt *float_utilst::cache_lookup(const float_utils_cachet::keyt &key) const
+{
+  if(cache == nullptr)
+    return nullptr;
+
+  const auto entry = cache->circuits.find(key);
+  if(entry == cache->circuits.end())
+    return nullptr;
+
+  return &entry->second;
+}
+
+/// Record \p result as the circuit for \p key, if there is a cache
+/// \return \p result
+bvt float_utilst::cache_insert(
+  const float_utils_cachet::keyt &key,
+  const bvt &result)
+{
+  if(cache != nullptr)
+    cache->circuits.emplace(key, result);
+
+  return result;
+}
@@ -10,10 +10,52 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_SOLVERS_FLOATBV_FLOAT_UTILS_H
 #define CPROVER_SOLVERS_FLOATBV_FLOAT_UTILS_H
 
+#include <map>
+#include <tuple>
+
 #include <util/ieee_float.h>
 
 #include <solvers/flattening/bv_utils.h>
 
+/// Circuits built by \ref float_utilst, keyed on the operation, the format,
+/// the rounding-mode literals and the operand literals. Instances of
+/// float_utilst that share a cache (and the same propt) encode each distinct
+/// operation only once.
+class float_utils_cachet
+{
+public:
+  enum class opt
+  {
+    ADD,
+    SUB,
+    MUL,
+    DIV,
+    EXPONENT_ALL_ONES,
+    FRACTION_ALL_ZEROS
+  };
+
+  typedef std::tuple<
+    opt,
+    std::size_t, // f
+    std::size_t, // e
+    bool,        // x86_extended
+    literalt,    // round_to_even
+    literalt,    // round_to_zero
+    literalt,    // round_to_plus_inf
+    literalt,    // round_to_minus_inf
+    bvt,
+    bvt>
+    keyt;
+
+  typedef std::map<keyt, bvt> circuitst;
+  circuitst circuits;
+
+  void clear()
+  {
+    circuits.clear();
+  }
+};
+
 class float_utilst
 {
 public:
@@ -68,19 +110,28 @@ public:
 
   explicit float_utilst(propt &_prop):
     prop(_prop),
-    bv_utils(_prop)
+    bv_utils(_prop),
+    cache(nullptr)
   {
   }
 
   float_utilst(propt &_prop, const floatbv_typet &type):
     spec(ieee_float_spect(type)),
     prop(_prop),
-    bv_utils(_prop)
+    bv_utils(_prop),
+    cache(nullptr)
   {
   }
 
   void set_rounding_mode(const bvt &);
 
+  /// Re-use circuits stored in \p _cache, and record new ones there. The
+  /// cache must only be shared among instances that use the same propt.
+  void set_cache(float_utils_cachet &_cache)
+  {
+    cache = &_cache;
+  }
+
   virtual ~float_utilst()
   {
   }
@@ -104,6 +155,7 @@ public:
   literalt is_plus_inf(const bvt &);
   literalt is_minus_inf(const bvt &);
   literalt is_NaN(const bvt &);
+  literalt is_finite(const bvt &); // neither infinity nor NaN
 
   // add/sub
   virtual bvt add_sub(const bvt &src1, const bvt &src2, bool subtract);
@@ -153,6 +205,12 @@ public:
 protected:
   propt &prop;
   bv_utilst bv_utils;
+  float_utils_cachet *cache;
+
+  float_utils_cachet::keyt
+  cache_key(float_utils_cachet::opt, const bvt &, const bvt &) const;
+  const bvt *cache_lookup(const float_utils_cachet::keyt &) const;
+  bvt cache_insert(const float_utils_cachet::keyt &, const bvt &);
 
   // unpacked
   virtual void normalization_shift(bvt &fraction, bvt &exponent);
@@ -12,8 +12,9 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <iostream>
 #endif
 
-#include <util/std_expr.h>
 #include <util/find_symbols.h>
+#include <util/simplify_expr.h>
+#include <util/std_expr.h>
 
 #include <solvers/sat/satcheck.h>
 
@@ -39,14 +40,11 @@ void bv_refinementt::arrays_overapproximated()
     return;
 
   unsigned nb_active=0;
+  unsigned nb_solver_checks = 0;
 
   std::list<lazy_constraintt>::iterator it=lazy_array_constraints.begin();
   while(it!=lazy_array_constraints.end())
   {
-    satcheck_no_simplifiert sat_check{log.get_message_handler()};
-    bv_pointerst solver{ns, sat_check, log.get_message_handler()};
-    solver.unbounded_array=bv_pointerst::unbounded_arrayt::U_ALL;
-
     exprt current=(*it).lazy;
 
     // some minor simplifications
@@ -77,6 +75,27 @@ void bv_refinementt::arrays_overapproximated()
     }
 
     exprt simplified=get(current);
+
+    // Most constraints evaluate to a constant in the current model: only
+    // those that are violated by the model need to be added.
+    simplify(simplified, ns);
+    if(simplified.is_true())
+    {
+      ++it;
+      continue;
+    }
+    else if(simplified.is_false())
+    {
+      prop.l_set_to_true(convert(current));
+      nb_active++;
+      lazy_array_constraints.erase(it++);
+      continue;
+    }
+
+    ++nb_solver_checks;
+    satcheck_no_simplifiert sat_check{log.get_message_handler()};
+    bv_pointerst solver{ns, sat_check, log.get_message_handler()};
+    solver.unbounded_array=bv_pointerst::unbounded_arrayt::U_ALL;
     solver << simplified;
 
     switch(static_cast<decision_proceduret::resultt>(sat_check.prop_solve()))
@@ -98,6 +117,9 @@ void bv_refinementt::arrays_overapproximated()
               << " array expressions become active" << messaget::eom;
   log.debug() << "BV-Refinement: " << lazy_array_constraints.size()
               << " inactive array expressions" << messaget::eom;
+  log.debug() << "BV-Refinement: " << nb_solver_checks
+              << " array expressions needed a solver to evaluate"
+              << messaget::eom;
   if(nb_active > 0)
     progress=true;
 }
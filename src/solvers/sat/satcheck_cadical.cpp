@@ -10,6 +10,7 @@ Author: Michael Tautschnig
 
 #include <util/exception_utils.h>
 #include <util/invariant.h>
+#include <util/metrics.h>
 #include <util/threeval.h>
 
 #ifdef HAVE_CADICAL
@@ -71,6 +72,8 @@ propt::resultt satcheck_cadicalt::do_prop_solve()
 
   log.statistics() << (no_variables() - 1) << " variables, " << clause_counter
                    << " clauses" << messaget::eom;
+  get_metrics().set("satVariables", no_variables() - 1);
+  get_metrics().set("satClauses", clause_counter);
 
   if(status == statust::UNSAT)
   {
@@ -15,6 +15,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <stack>
 
 #include <util/invariant.h>
+#include <util/metrics.h>
 #include <util/threeval.h>
 
 #include <core/Solver.h>
@@ -139,6 +140,8 @@ propt::resultt satcheck_glucose_baset<T>::do_prop_solve()
   // We start counting at 1, thus there is one variable fewer.
   log.statistics() << (no_variables() - 1) << " variables, "
                    << solver->nClauses() << " clauses" << messaget::eom;
+  get_metrics().set("satVariables", no_variables() - 1);
+  get_metrics().set("satClauses", solver->nClauses());
 
   try
   {
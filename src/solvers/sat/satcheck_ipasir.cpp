@@ -15,6 +15,7 @@ Author: Norbert Manthey, nmanthey@amazon.com
 
 #include <util/exception_utils.h>
 #include <util/invariant.h>
+#include <util/metrics.h>
 #include <util/threeval.h>
 
 #include "satcheck_ipasir.h"
@@ -99,6 +100,8 @@ propt::resultt satcheck_ipasirt::do_prop_solve()
 
   log.statistics() << (no_variables() - 1) << " variables, " << clause_counter
                    << " clauses" << messaget::eom;
+  get_metrics().set("satVariables", no_variables() - 1);
+  get_metrics().set("satClauses", clause_counter);
 
   // use the internal representation, as ipasir does not support reporting the
   // status
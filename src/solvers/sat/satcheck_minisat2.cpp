@@ -18,6 +18,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <stack>
 
 #include <util/invariant.h>
+#include <util/metrics.h>
 #include <util/threeval.h>
 
 #include <minisat/core/Solver.h>
@@ -171,6 +172,8 @@ propt::resultt satcheck_minisat2_baset<T>::do_prop_solve()
 
   log.statistics() << (no_variables() - 1) << " variables, "
                    << solver->nClauses() << " clauses" << messaget::eom;
+  get_metrics().set("satVariables", no_variables() - 1);
+  get_metrics().set("satClauses", solver->nClauses());
 
   try
   {
@@ -129,6 +129,7 @@ void string_dependenciest::clear()
 {
   builtin_function_nodes.clear();
   string_nodes.clear();
+  constrained_nodes.clear();
   node_index_pool.clear();
   clean_cache();
 }
@@ -363,16 +364,26 @@ string_dependenciest::add_constraints(string_constraint_generatort &generator)
       for_each_successor(n, f);
     });
 
+  constrained_nodes.resize(builtin_function_nodes.size(), constrainedt::NONE);
+
   string_constraintst constraints;
   for(const auto &node : builtin_function_nodes)
   {
+    constrainedt &constrained = constrained_nodes[node.index];
     if(test_dependencies.count(nodet(node)))
     {
-      const auto &builtin = builtin_function_nodes[node.index];
-      merge(constraints, builtin.data->constraints(generator));
+      if(constrained != constrainedt::FULL)
+      {
+        const auto &builtin = builtin_function_nodes[node.index];
+        merge(constraints, builtin.data->constraints(generator));
+        constrained = constrainedt::FULL;
+      }
     }
-    else
+    else if(constrained == constrainedt::NONE)
+    {
       constraints.existential.push_back(node.data->length_constraint());
+      constrained = constrainedt::LENGTH;
+    }
   }
   return constraints;
 }
@@ -115,6 +115,8 @@ public:
   /// For all builtin call on which a test (or an unsupported buitin)
   /// result depends, add the corresponding constraints. For the other builtin
   /// only add constraints on the length.
+  /// Constraints returned by a previous call are not returned again, so that
+  /// repeated calls only produce the constraints for new nodes.
   NODISCARD string_constraintst
   add_constraints(string_constraint_generatort &generatort);
 
@@ -128,6 +130,18 @@ private:
   /// Set of nodes representing strings
   std::vector<string_nodet> string_nodes;
 
+  /// Constraints already generated by `add_constraints` for a builtin
+  /// function node
+  enum class constrainedt
+  {
+    NONE,
+    LENGTH,
+    FULL
+  };
+
+  /// Indexed like `builtin_function_nodes`
+  std::vector<constrainedt> constrained_nodes;
+
   /// Nodes describing dependencies of a string: values of the map correspond
   /// to indexes in the vector `string_nodes`.
   std::unordered_map<array_string_exprt, std::size_t, irep_hash>
@@ -85,7 +85,9 @@ static void initial_index_set(
 static void initial_index_set(
   index_set_pairt &index_set,
   const namespacet &ns,
-  const string_axiomst &axioms);
+  const string_axiomst &axioms,
+  std::size_t first_universal,
+  std::size_t first_not_contains);
 
 exprt simplify_sum(const exprt &f);
 
@@ -216,27 +218,55 @@ display_index_set(messaget::mstreamt &stream, const index_set_pairt &index_set)
 // NOLINTNEXTLINE(whitespace/line_length)
 ///     (See `instantiate(const string_not_contains_constraintt&,const index_set_pairt&,const std::map<string_not_contains_constraintt, symbol_exprt>&)`
 ///      for details)
+///
+/// Only the axioms before \p instantiated_universal and
+/// \p instantiated_not_contains have been instantiated before: these only
+/// need the indices in `index_set.current`, whereas the remaining ones are
+/// instantiated with the whole of `index_set.cumulative`.
 static std::vector<exprt> generate_instantiations(
   const index_set_pairt &index_set,
   const string_axiomst &axioms,
   const std::unordered_map<string_not_contains_constraintt, symbol_exprt>
-    &not_contain_witnesses)
+    &not_contain_witnesses,
+  const std::size_t instantiated_universal,
+  const std::size_t instantiated_not_contains)
 {
+  PRECONDITION(instantiated_universal <= axioms.universal.size());
+  PRECONDITION(instantiated_not_contains <= axioms.not_contains.size());
+
   std::vector<exprt> lemmas;
-  for(const auto &i : index_set.current)
+  for(std::size_t n = 0; n < axioms.universal.size(); ++n)
   {
-    for(const auto &univ_axiom : axioms.universal)
+    const auto &indices =
+      n < instantiated_universal ? index_set.current : index_set.cumulative;
+    for(const auto &i : indices)
     {
       for(const auto &j : i.second)
-        lemmas.push_back(instantiate(univ_axiom, i.first, j));
+        lemmas.push_back(instantiate(axioms.universal[n], i.first, j));
     }
   }
-  for(const auto &nc_axiom : axioms.not_contains)
+
+  for(std::size_t n = 0; n < instantiated_not_contains; ++n)
   {
     for(const auto &instance :
-        instantiate(nc_axiom, index_set, not_contain_witnesses))
+        instantiate(axioms.not_contains[n], index_set, not_contain_witnesses))
       lemmas.push_back(instance);
   }
+
+  if(instantiated_not_contains < axioms.not_contains.size())
+  {
+    // new axioms: treat every index as new
+    const index_set_pairt whole_index_set{index_set.cumulative,
+                                          index_set.cumulative};
+    for(std::size_t n = instantiated_not_contains;
+        n < axioms.not_contains.size();
+        ++n)
+    {
+      for(const auto &instance : instantiate(
+            axioms.not_contains[n], whole_index_set, not_contain_witnesses))
+        lemmas.push_back(instance);
+    }
+  }
   return lemmas;
 }
 
@@ -750,10 +780,13 @@ decision_proceduret::resultt string_refinementt::dec_solve()
     });
 
   // Used to store information about witnesses for not_contains constraints
-  std::unordered_map<string_not_contains_constraintt, symbol_exprt>
-    not_contain_witnesses;
-  for(const auto &nc_axiom : axioms.not_contains)
+  for(std::size_t n = instantiated_not_contains_axioms;
+      n < axioms.not_contains.size();
+      ++n)
   {
+    const auto &nc_axiom = axioms.not_contains[n];
+    if(not_contain_witnesses.count(nc_axiom) != 0)
+      continue;
     const auto &witness_type = [&] {
       const auto &rtype = to_array_type(nc_axiom.s0.type());
       const typet &index_type = rtype.size().type();
@@ -807,11 +840,25 @@ decision_proceduret::resultt string_refinementt::dec_solve()
     return initial_result;
   }
 
-  initial_index_set(index_sets, ns, axioms);
+  // The index set and the instantiations are kept from previous calls, so
+  // that only new indices and new axioms give rise to new lemmas.
+  index_sets.current.clear();
+  initial_index_set(
+    index_sets,
+    ns,
+    axioms,
+    instantiated_universal_axioms,
+    instantiated_not_contains_axioms);
   update_index_set(index_sets, ns, current_constraints);
   current_constraints.clear();
-  const auto initial_instances =
-    generate_instantiations(index_sets, axioms, not_contain_witnesses);
+  const auto initial_instances = generate_instantiations(
+    index_sets,
+    axioms,
+    not_contain_witnesses,
+    instantiated_universal_axioms,
+    instantiated_not_contains_axioms);
+  instantiated_universal_axioms = axioms.universal.size();
+  instantiated_not_contains_axioms = axioms.not_contains.size();
   for(const auto &instance : initial_instances)
   {
     add_lemma(substitute_array_access(instance, generator.fresh_symbol, true));
@@ -871,8 +918,12 @@ decision_proceduret::resultt string_refinementt::dec_solve()
         }
       }
       current_constraints.clear();
-      const auto instances =
-        generate_instantiations(index_sets, axioms, not_contain_witnesses);
+      const auto instances = generate_instantiations(
+        index_sets,
+        axioms,
+        not_contain_witnesses,
+        instantiated_universal_axioms,
+        instantiated_not_contains_axioms);
       for(const auto &instance : instances)
         add_lemma(
           substitute_array_access(instance, generator.fresh_symbol, true));
@@ -1508,15 +1559,21 @@ exprt simplify_sum(const exprt &f)
 /// \param index_set: set of indexes to update
 /// \param ns: namespace
 /// \param axioms: a list of string axioms
+/// \param first_universal: position of the first universal axiom to consider,
+///   the ones before it have already contributed to \p index_set
+/// \param first_not_contains: position of the first not_contains axiom to
+///   consider
 static void initial_index_set(
   index_set_pairt &index_set,
   const namespacet &ns,
-  const string_axiomst &axioms)
+  const string_axiomst &axioms,
+  std::size_t first_universal,
+  std::size_t first_not_contains)
 {
-  for(const auto &axiom : axioms.universal)
-    initial_index_set(index_set, ns, axiom);
-  for(const auto &axiom : axioms.not_contains)
-    initial_index_set(index_set, ns, axiom);
+  for(std::size_t n = first_universal; n < axioms.universal.size(); ++n)
+    initial_index_set(index_set, ns, axioms.universal[n]);
+  for(std::size_t n = first_not_contains; n < axioms.not_contains.size(); ++n)
+    initial_index_set(index_set, ns, axioms.not_contains[n]);
 }
 
 /// Add to the index set all the indices that appear in the formulas.
@@ -21,6 +21,8 @@ Author: Alberto Griggio, alberto.griggio@gmail.com
 #define CPROVER_SOLVERS_REFINEMENT_STRING_REFINEMENT_H
 
 #include <limits>
+#include <unordered_set>
+
 #include <util/magic.h>
 #include <util/replace_expr.h>
 #include <util/string_expr.h>
@@ -102,10 +104,22 @@ private:
   string_constraint_generatort generator;
 
   // Simple constraints that have been given to the solver
-  std::set<exprt> seen_instances;
+  std::unordered_set<exprt, irep_hash> seen_instances;
 
   string_axiomst axioms;
 
+  // Number of axioms, at the front of `axioms.universal` and
+  // `axioms.not_contains`, which have been instantiated with every index of
+  // `index_sets.cumulative`; later calls to `dec_solve` only need to
+  // instantiate them with new indices
+  std::size_t instantiated_universal_axioms = 0;
+  std::size_t instantiated_not_contains_axioms = 0;
+
+  // Witnesses for the not_contains axioms, kept across calls to `dec_solve`
+  // so that lemmas from earlier calls remain valid
+  std::unordered_map<string_not_contains_constraintt, symbol_exprt>
+    not_contain_witnesses;
+
   // Unquantified lemmas that have newly been added
   std::vector<exprt> current_constraints;
 
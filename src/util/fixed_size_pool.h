@@ -0,0 +1,98 @@
+/*******************************************************************\
+
+Module: Pool allocator for objects of a fixed size
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Pool allocator for objects of a fixed size
+
+#ifndef CPROVER_UTIL_FIXED_SIZE_POOL_H
+#define CPROVER_UTIL_FIXED_SIZE_POOL_H
+
+#include <cstddef>
+#include <new>
+
+/// Allocator for many small, short-lived objects of the same size. Objects are
+/// carved out of blocks of `block_size` bytes, and freed objects are kept on a
+/// free list for reuse rather than being returned to the heap. This avoids the
+/// per-object overhead of the general-purpose allocator, and keeps the objects
+/// together instead of fragmenting the heap. Blocks are never released.
+///
+/// Free lists are per thread, so no locking is needed. An object may be freed
+/// by a thread other than the one that allocated it; it is then reused by the
+/// thread that freed it.
+/// \tparam object_size: size of the objects in bytes
+template <std::size_t object_size>
+class fixed_size_poolt
+{
+public:
+  static void *allocate()
+  {
+    freet *&head = free_list();
+    if(head == nullptr)
+      head = allocate_block();
+
+    freet *result = head;
+    head = head->next;
+    return result;
+  }
+
+  static void deallocate(void *p)
+  {
+    if(p == nullptr)
+      return;
+
+    freet *&head = free_list();
+    freet *f = static_cast<freet *>(p);
+    f->next = head;
+    head = f;
+  }
+
+private:
+  struct freet
+  {
+    freet *next;
+  };
+
+  static constexpr std::size_t alignment = alignof(std::max_align_t);
+
+  /// Size of each object, enough to hold a free-list entry and rounded up to
+  /// keep all objects in a block aligned
+  static constexpr std::size_t slot_size =
+    ((object_size < sizeof(freet) ? sizeof(freet) : object_size) + alignment -
+     1) /
+    alignment * alignment;
+
+  static constexpr std::size_t block_size = 64 * 1024;
+  static constexpr std::size_t slots_per_block =
+    block_size / slot_size == 0 ? 1 : block_size / slot_size;
+
+  static freet *&free_list()
+  {
+    static thread_local freet *head = nullptr;
+    return head;
+  }
+
+  /// Allocate a new block and link all its slots into a free list
+  /// \return the first slot of the block
+  static freet *allocate_block()
+  {
+    char *block =
+      static_cast<char *>(::operator new(slot_size * slots_per_block));
+
+    freet *next = nullptr;
+    for(std::size_t i = slots_per_block; i-- > 0;)
+    {
+      freet *f = reinterpret_cast<freet *>(block + i * slot_size);
+      f->next = next;
+      next = f;
+    }
+
+    return next;
+  }
+};
+
+#endif // CPROVER_UTIL_FIXED_SIZE_POOL_H
@@ -9,6 +9,8 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "ieee_float.h"
 
 #include <ostream>
+#include <cfenv>
+#include <cfloat>
 #include <cmath>
 #include <limits>
 
@@ -700,26 +702,164 @@ constant_exprt ieee_floatt::to_expr() const
   return constant_exprt(integer2bvrep(pack(), spec.width()), spec.to_type());
 }
 
+// The host FPU can only be used if it evaluates float and double expressions
+// in their own precision, as opposed to x87 extended precision, and supports
+// all static rounding modes.
+#if FLT_EVAL_METHOD == 0 && defined(FE_TONEAREST) && defined(FE_DOWNWARD) && \
+  defined(FE_UPWARD) && defined(FE_TOWARDZERO)
+#  define IEEE_FLOAT_NATIVE
+#endif
+
+#ifdef IEEE_FLOAT_NATIVE
+/// Compute \p lhs \p operation \p rhs on the host FPU, with the rounding
+/// mode set to \p rounding
+template <typename T, typename operationt>
+static T
+native_apply(const T lhs, const T rhs, const int rounding, operationt operation)
+{
+  const int old_rounding = std::fegetround();
+  std::fesetround(rounding);
+
+  // the volatile accesses keep the compiler from evaluating the operation
+  // before or after the rounding mode is changed
+  volatile T a = lhs;
+  volatile T b = rhs;
+  volatile T result = operation(a, b);
+
+  std::fesetround(old_rounding);
+  return result;
+}
+#endif
+
+/// Apply \p operation to this and \p other using the host FPU. This is only
+/// possible for single and double precision, for finite operands, and for
+/// static rounding modes. NaN results are left to the software implementation
+/// as their sign and payload are host specific.
+/// \return true if the operation was done, false if the software
+///   implementation needs to be used
+bool ieee_floatt::native_operation(
+  const ieee_floatt &other,
+  native_operationt operation)
+{
+#ifdef IEEE_FLOAT_NATIVE
+  if(
+    spec != other.spec || NaN_flag || other.NaN_flag || infinity_flag ||
+    other.infinity_flag)
+  {
+    return false;
+  }
+
+  int rounding;
+  switch(rounding_mode)
+  {
+  case ROUND_TO_EVEN:
+    rounding = FE_TONEAREST;
+    break;
+  case ROUND_TO_MINUS_INF:
+    rounding = FE_DOWNWARD;
+    break;
+  case ROUND_TO_PLUS_INF:
+    rounding = FE_UPWARD;
+    break;
+  case ROUND_TO_ZERO:
+    rounding = FE_TOWARDZERO;
+    break;
+  case UNKNOWN:
+  case NONDETERMINISTIC:
+  default:
+    return false;
+  }
+
+  ieee_floatt result(spec);
+  result.rounding_mode = rounding_mode;
+
+  if(is_double())
+  {
+    const double value = native_apply(
+      to_double(),
+      other.to_double(),
+      rounding,
+      [operation](double a, double b) {
+        return operation == native_operationt::ADD
+                 ? a + b
+                 : operation == native_operationt::MULTIPLY ? a * b : a / b;
+      });
+    if(std::isnan(value))
+      return false;
+    result.from_double(value);
+  }
+  else if(is_float())
+  {
+    const float value = native_apply(
+      to_float(),
+      other.to_float(),
+      rounding,
+      [operation](float a, float b) {
+        return operation == native_operationt::ADD
+                 ? a + b
+                 : operation == native_operationt::MULTIPLY ? a * b : a / b;
+      });
+    if(std::isnan(value))
+      return false;
+    result.from_float(value);
+  }
+  else
+    return false;
+
+#  ifdef IEEE_FLOAT_NATIVE_CHECKS
+  ieee_floatt expected = *this;
+  switch(operation)
+  {
+  case native_operationt::ADD:
+    expected.add(other);
+    break;
+  case native_operationt::MULTIPLY:
+    expected.multiply(other);
+    break;
+  case native_operationt::DIVIDE:
+    expected.divide(other);
+    break;
+  }
+  INVARIANT(
+    expected.pack() == result.pack(),
+    "host FPU and software implementation must agree");
+#  endif
+
+  *this = result;
+  return true;
+#else
+  return false;
+#endif
+}
+
 ieee_floatt &ieee_floatt::operator/=(const ieee_floatt &other)
 {
   PRECONDITION(other.spec.f == spec.f);
 
+  if(!native_operation(other, native_operationt::DIVIDE))
+    divide(other);
+
+  return *this;
+}
+
+void ieee_floatt::divide(const ieee_floatt &other)
+{
   // NaN/x = NaN
   if(NaN_flag)
-    return *this;
+    return;
 
   // x/NaN = NaN
   if(other.NaN_flag)
   {
     make_NaN();
-    return *this;
+    return;
   }
 
   // 0/0 = NaN
   if(is_zero() && other.is_zero())
   {
     make_NaN();
-    return *this;
+    return;
   }
 
   // x/0 = +-inf
@@ -728,7 +868,7 @@ ieee_floatt &ieee_floatt::operator/=(const ieee_floatt &other)
     infinity_flag=true;
     if(other.sign_flag)
       negate();
-    return *this;
+    return;
   }
 
   // x/inf = NaN
@@ -737,7 +877,7 @@ ieee_floatt &ieee_floatt::operator/=(const ieee_floatt &other)
     if(infinity_flag)
     {
       make_NaN();
-      return *this;
+      return;
     }
 
     bool old_sign=sign_flag;
@@ -747,14 +887,14 @@ ieee_floatt &ieee_floatt::operator/=(const ieee_floatt &other)
     if(other.sign_flag)
       negate();
 
-    return *this;
+    return;
   } // inf/x = inf
   else if(infinity_flag)
   {
     if(other.sign_flag)
       negate();
 
-    return *this;
+    return;
   }
 
   exponent-=other.exponent;
@@ -770,18 +910,24 @@ ieee_floatt &ieee_floatt::operator/=(const ieee_floatt &other)
     negate();
 
   align();
-
-  return *this;
 }
 
 ieee_floatt &ieee_floatt::operator*=(const ieee_floatt &other)
 {
   PRECONDITION(other.spec.f == spec.f);
 
+  if(!native_operation(other, native_operationt::MULTIPLY))
+    multiply(other);
+
+  return *this;
+}
+
+void ieee_floatt::multiply(const ieee_floatt &other)
+{
   if(other.NaN_flag)
     make_NaN();
   if(NaN_flag)
-    return *this;
+    return;
 
   if(infinity_flag || other.infinity_flag)
   {
@@ -789,13 +935,13 @@ ieee_floatt &ieee_floatt::operator*=(const ieee_floatt &other)
     {
       // special case Inf * 0 is NaN
       make_NaN();
-      return *this;
+      return;
     }
 
     if(other.sign_flag)
       negate();
     infinity_flag=true;
-    return *this;
+    return;
   }
 
   exponent+=other.exponent;
@@ -806,52 +952,59 @@ ieee_floatt &ieee_floatt::operator*=(const ieee_floatt &other)
     negate();
 
   align();
-
-  return *this;
 }
 
 ieee_floatt &ieee_floatt::operator+=(const ieee_floatt &other)
 {
   PRECONDITION(other.spec == spec);
+
+  if(!native_operation(other, native_operationt::ADD))
+    add(other);
+
+  return *this;
+}
+
+void ieee_floatt::add(const ieee_floatt &other)
+{
   ieee_floatt _other=other;
 
   if(other.NaN_flag)
     make_NaN();
   if(NaN_flag)
-    return *this;
+    return;
 
   if(infinity_flag && other.infinity_flag)
   {
     if(sign_flag==other.sign_flag)
-      return *this;
+      return;
     make_NaN();
-    return *this;
+    return;
   }
   else if(infinity_flag)
-    return *this;
+    return;
   else if(other.infinity_flag)
   {
     infinity_flag=true;
     sign_flag=other.sign_flag;
-    return *this;
+    return;
   }
 
   // 0 + 0 needs special treatment for the signs
   if(is_zero() && other.is_zero())
   {
     if(get_sign()==other.get_sign())
-      return *this;
+      return;
     else
     {
       if(rounding_mode==ROUND_TO_MINUS_INF)
       {
         set_sign(true);
-        return *this;
+        return;
       }
       else
       {
         set_sign(false);
-        return *this;
+        return;
       }
     }
   }
@@ -897,8 +1050,6 @@ ieee_floatt &ieee_floatt::operator+=(const ieee_floatt &other)
   }
 
   align();
-
-  return *this;
 }
 
 ieee_floatt &ieee_floatt::operator-=(const ieee_floatt &other)
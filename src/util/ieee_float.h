@@ -301,6 +301,20 @@ public:
   bool ieee_not_equal(const ieee_floatt &other) const;
 
 protected:
+  enum class native_operationt
+  {
+    ADD,
+    MULTIPLY,
+    DIVIDE
+  };
+
+  bool native_operation(const ieee_floatt &other, native_operationt operation);
+
+  // software implementations of the operators, for any format
+  void add(const ieee_floatt &other);
+  void multiply(const ieee_floatt &other);
+  void divide(const ieee_floatt &other);
+
   void divide_and_round(mp_integer &dividend, const mp_integer &divisor);
   void align();
   void next_representable(bool greater);
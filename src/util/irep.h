@@ -15,12 +15,22 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "invariant.h"
 #include "irep_ids.h"
+#include "shared_field.h"
 
 #define SHARING
 #ifndef HASH_CODE
 #  define HASH_CODE 1
 #endif
-// #define NAMED_SUB_IS_FORWARD_LIST
+// Allocate tree nodes from a fixed_size_poolt instead of the heap
+#ifndef IREP_POOL
+#  define IREP_POOL 0
+#endif
+// Store named_sub as a sorted forward list, which takes a single pointer in
+// the node and one small allocation per entry. Define NAMED_SUB_IS_STD_MAP to
+// use a std::map instead.
+#ifndef NAMED_SUB_IS_STD_MAP
+#  define NAMED_SUB_IS_FORWARD_LIST
+#endif
 
 #ifdef NAMED_SUB_IS_FORWARD_LIST
 #  include "forward_list_as_map.h"
@@ -28,6 +38,10 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <map>
 #endif
 
+#if IREP_POOL
+#  include "fixed_size_pool.h"
+#endif
+
 #ifdef USE_DSTRING
 typedef dstringt irep_idt;
 typedef dstringt irep_namet;
@@ -93,7 +107,7 @@ struct ref_count_ift
 template <>
 struct ref_count_ift<true>
 {
-  unsigned ref_count = 1;
+  shared_fieldt<unsigned> ref_count = 1;
 };
 
 /// A node with data in a tree, it contains:
@@ -105,16 +119,20 @@ struct ref_count_ift<true>
 /// * \ref irept::dt::named_sub : A map from `irep_namet` (a string) to \ref
 ///   irept. This is used for named children, i.e.  subexpressions, parameters,
 ///   etc. Children whose name begins with '#' are ignored by the
-///   default \ref operator==.
+///   default \ref operator==. Unless `NAMED_SUB_IS_STD_MAP` is set, this is a
+///   \ref forward_list_as_mapt sorted by the number of the `irep_namet`.
 ///
 /// * \ref irept::dt::sub : A vector of \ref irept which is used to store
 ///   ordered but unnamed children.
 ///
 /// * \c ref_count : if sharing is activated, this is used to count the number
-///   of references to a node.
+///   of references to a node. If ATOMIC_REF_COUNT is set, it is atomic, so that
+///   ireps can be shared between threads (as long as they are only read).
 ///
 /// * \c hash_code : if HASH_CODE is activated, this is used to cache the
-///   result of the hash function.
+///   result of the hash function. It is atomic if ATOMIC_REF_COUNT is set.
+///
+/// If IREP_POOL is set, nodes are allocated from a \ref fixed_size_poolt.
 template <typename treet, typename named_subtreest, bool sharing = true>
 class tree_nodet : public ref_count_ift<sharing>
 {
@@ -136,7 +154,7 @@ public:
   subt sub;
 
 #if HASH_CODE
-  mutable std::size_t hash_code = 0;
+  mutable shared_fieldt<std::size_t> hash_code = 0;
 #endif
 
   void clear()
@@ -171,6 +189,19 @@ public:
       sub(std::move(_sub))
   {
   }
+
+#if IREP_POOL
+  static void *operator new(std::size_t size)
+  {
+    PRECONDITION(size == sizeof(tree_nodet));
+    return fixed_size_poolt<sizeof(tree_nodet)>::allocate();
+  }
+
+  static void operator delete(void *p)
+  {
+    fixed_size_poolt<sizeof(tree_nodet)>::deallocate(p);
+  }
+#endif
 };
 
 /// Base class for tree-like data structures with sharing
@@ -586,8 +617,8 @@ void sharing_treet<derivedt, named_subtreest>::remove_ref(dt *old_data)
   std::cout << "R: " << old_data << " " << old_data->ref_count << '\n';
 #endif
 
-  old_data->ref_count--;
-  if(old_data->ref_count == 0)
+  // decrement and test in one step, as other threads may hold references
+  if(--old_data->ref_count == 0)
   {
 #ifdef IREP_DEBUG
     std::cout << "D: " << pretty() << '\n';
@@ -622,9 +653,7 @@ void sharing_treet<derivedt, named_subtreest>::nonrecursive_destructor(
       continue;
 
     INVARIANT(d->ref_count != 0, "All contents of the stack must be in use");
-    d->ref_count--;
-
-    if(d->ref_count == 0)
+    if(--d->ref_count == 0)
     {
       stack.reserve(
         stack.size() + std::distance(d->named_sub.begin(), d->named_sub.end()) +
@@ -18,6 +18,10 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <malloc.h>
 #endif
 
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
 #ifdef _WIN32
 #include <util/pragma_push.def>
 #ifdef _MSC_VER
@@ -72,3 +76,27 @@ void memory_info(std::ostream &out)
       << static_cast<double>(t.size_allocated)/1000000 << "m\n";
 #endif
 }
+
+std::size_t peak_memory_usage()
+{
+#if defined(__linux__) || defined(__APPLE__)
+  // NOLINTNEXTLINE(readability/identifiers)
+  struct rusage usage;
+  if(getrusage(RUSAGE_SELF, &usage) != 0)
+    return 0;
+#ifdef __APPLE__
+  // reported in bytes
+  return static_cast<std::size_t>(usage.ru_maxrss);
+#else
+  // reported in kilobytes
+  return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+#endif
+#elif defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS pmc;
+  if(GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+    return pmc.PeakWorkingSetSize;
+  return 0;
+#else
+  return 0;
+#endif
+}
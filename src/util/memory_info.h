@@ -10,8 +10,13 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_UTIL_MEMORY_INFO_H
 #define CPROVER_UTIL_MEMORY_INFO_H
 
+#include <cstddef>
 #include <iosfwd>
 
 void memory_info(std::ostream &);
 
+/// \return the largest amount of memory in bytes that the process has had
+///   resident at any one time, or zero if this is not known on this platform
+std::size_t peak_memory_usage();
+
 #endif // CPROVER_UTIL_MEMORY_INFO_H
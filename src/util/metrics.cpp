@@ -0,0 +1,83 @@
+/*******************************************************************\
+
+Module: Registry of performance metrics
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Registry of performance metrics
+
+#include "metrics.h"
+
+#include "json.h"
+#include "memory_info.h"
+
+#include <ostream>
+
+void metricst::add_time(
+  const char *name,
+  std::chrono::duration<double> wall_time,
+  std::chrono::duration<double> cpu_time)
+{
+  if(!is_enabled)
+    return;
+
+  phaset &phase = phases[name];
+  ++phase.count;
+  phase.wall_time += wall_time;
+  phase.cpu_time += cpu_time;
+}
+
+json_objectt metricst::to_json() const
+{
+  json_objectt json_phases;
+  for(const auto &entry : phases)
+  {
+    const phaset &phase = entry.second;
+    json_phases[entry.first] = json_objectt{
+      {"count", json_numbert(std::to_string(phase.count))},
+      {"wallTime", json_numbert(std::to_string(phase.wall_time.count()))},
+      {"cpuTime", json_numbert(std::to_string(phase.cpu_time.count()))}};
+  }
+
+  json_objectt json_counters;
+  for(const auto &entry : counters)
+    json_counters[entry.first] = json_numbert(std::to_string(entry.second));
+
+  json_objectt json_gauges;
+  for(const auto &entry : gauges)
+    json_gauges[entry.first] = json_numbert(std::to_string(entry.second));
+
+  return json_objectt{
+    {"phases", std::move(json_phases)},
+    {"counters", std::move(json_counters)},
+    {"gauges", std::move(json_gauges)},
+    {"peakMemory", json_numbert(std::to_string(peak_memory_usage()))}};
+}
+
+void metricst::output_json(std::ostream &out) const
+{
+  out << to_json() << '\n';
+}
+
+metricst &get_metrics()
+{
+  static metricst metrics;
+  return metrics;
+}
+
+scoped_metrics_timert::~scoped_metrics_timert()
+{
+  if(name == nullptr)
+    return;
+
+  const std::clock_t cpu_stop = std::clock();
+  const auto wall_stop = std::chrono::steady_clock::now();
+  get_metrics().add_time(
+    name,
+    wall_stop - wall_start,
+    std::chrono::duration<double>(
+      static_cast<double>(cpu_stop - cpu_start) / CLOCKS_PER_SEC));
+}
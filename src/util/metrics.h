@@ -0,0 +1,123 @@
+/*******************************************************************\
+
+Module: Registry of performance metrics
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Registry of performance metrics
+
+#ifndef CPROVER_UTIL_METRICS_H
+#define CPROVER_UTIL_METRICS_H
+
+#include <chrono>
+#include <cstddef>
+#include <ctime>
+#include <iosfwd>
+#include <map>
+#include <string>
+
+#define OPT_METRICS "(metrics-json):"
+
+#define HELP_METRICS                                                           \
+  " --metrics-json file          write timing, memory and other statistics\n"  \
+  "                              of the run to file in JSON format\n"
+
+class json_objectt;
+
+/// Named counters, gauges and phase timers that any module can update and
+/// that are reported together at the end of a run. Nothing is recorded until
+/// the registry is enabled, so updates cost a single test when no report has
+/// been requested. The registry is not thread-safe.
+class metricst
+{
+public:
+  void enable()
+  {
+    is_enabled = true;
+  }
+
+  bool enabled() const
+  {
+    return is_enabled;
+  }
+
+  /// Add \p value to the counter \p name
+  void add(const char *name, std::size_t value = 1)
+  {
+    if(is_enabled)
+      counters[name] += value;
+  }
+
+  /// Set the gauge \p name to its most recent value \p value
+  void set(const char *name, std::size_t value)
+  {
+    if(is_enabled)
+      gauges[name] = value;
+  }
+
+  /// Record one execution of the phase \p name
+  /// \param name: name of the phase
+  /// \param wall_time: elapsed wall-clock time
+  /// \param cpu_time: CPU time used by the process
+  void add_time(
+    const char *name,
+    std::chrono::duration<double> wall_time,
+    std::chrono::duration<double> cpu_time);
+
+  /// \return the metrics recorded so far, and the peak memory usage of the
+  ///   process
+  json_objectt to_json() const;
+
+  void output_json(std::ostream &) const;
+
+protected:
+  bool is_enabled = false;
+
+  std::map<std::string, std::size_t> counters;
+  std::map<std::string, std::size_t> gauges;
+
+  struct phaset
+  {
+    std::size_t count = 0;
+    std::chrono::duration<double> wall_time{0};
+    std::chrono::duration<double> cpu_time{0};
+  };
+
+  std::map<std::string, phaset> phases;
+};
+
+/// \return the registry shared by all modules of a tool
+metricst &get_metrics();
+
+/// Records the wall-clock and CPU time between its construction and its
+/// destruction as one execution of a phase of \ref get_metrics()
+class scoped_metrics_timert
+{
+public:
+  /// \param name: name of the phase, which must outlive the timer
+  explicit scoped_metrics_timert(const char *name)
+    : name(get_metrics().enabled() ? name : nullptr)
+  {
+    if(this->name != nullptr)
+    {
+      wall_start = std::chrono::steady_clock::now();
+      cpu_start = std::clock();
+    }
+  }
+
+  scoped_metrics_timert(const scoped_metrics_timert &) = delete;
+  scoped_metrics_timert &operator=(const scoped_metrics_timert &) = delete;
+
+  ~scoped_metrics_timert();
+
+protected:
+  /// Name of the phase, or nullptr if metrics are disabled
+  const char *name;
+  std::chrono::steady_clock::time_point wall_start;
+  std::clock_t cpu_start = 0;
+};
+
+#endif // CPROVER_UTIL_METRICS_H
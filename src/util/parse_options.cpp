@@ -11,6 +11,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <algorithm>
 #include <cctype>
 #include <climits>
+#include <fstream>
 #include <iostream>
 
 #if defined (_WIN32)
@@ -23,8 +24,10 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "cmdline.h"
 #include "exception_utils.h"
 #include "exit_codes.h"
+#include "metrics.h"
 #include "signal_catcher.h"
 #include "string_utils.h"
+#include "unicode.h"
 
 parse_options_baset::parse_options_baset(
   const std::string &_optstring,
@@ -80,7 +83,17 @@ int parse_options_baset::main()
     // install signal catcher
     install_signal_catcher();
 
-    return doit();
+    if(!cmdline.isset("metrics-json"))
+      return doit();
+
+    get_metrics().enable();
+    int exit_code;
+    {
+      scoped_metrics_timert timer("total");
+      exit_code = doit();
+    }
+    output_metrics(cmdline.get_value("metrics-json"));
+    return exit_code;
   }
 
   // CPROVER style exceptions in order of decreasing happiness
@@ -132,6 +145,23 @@ int parse_options_baset::main()
   }
 }
 
+void parse_options_baset::output_metrics(const std::string &file_name)
+{
+#ifdef _MSC_VER
+  std::ofstream out(widen(file_name));
+#else
+  std::ofstream out(file_name);
+#endif
+  if(!out)
+  {
+    log.error() << "failed to open metrics file '" << file_name << "'"
+                << messaget::eom;
+    return;
+  }
+
+  get_metrics().output_json(out);
+}
+
 std::string align_center_with_border(const std::string &text)
 {
   auto const total_length = std::size_t{63};
@@ -44,6 +44,10 @@ protected:
 
 private:
   void unknown_option_msg();
+
+  /// Write the metrics collected during the run in JSON format to the file
+  /// given by `--metrics-json`
+  void output_metrics(const std::string &file_name);
 };
 
 std::string
@@ -0,0 +1,115 @@
+/*******************************************************************\
+
+Module: Reference counts and caches of shared nodes
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Reference counts and caches of shared nodes
+
+#ifndef CPROVER_UTIL_SHARED_FIELD_H
+#define CPROVER_UTIL_SHARED_FIELD_H
+
+// Make the reference counts and cached hash codes of irept and sharing_mapt
+// nodes atomic, so that these can be shared between threads. Note that
+// creating new irep_idt strings is still not thread-safe, so other threads
+// may only use the identifiers that already exist.
+#ifndef ATOMIC_REF_COUNT
+#  define ATOMIC_REF_COUNT 0
+#endif
+
+#if ATOMIC_REF_COUNT
+
+#  include <atomic>
+
+/// An atomic field that can be copied, with the memory orderings of a
+/// reference count: increments are relaxed, decrements synchronize with the
+/// final decrement (so that the last owner sees all uses before deleting),
+/// reads acquire and writes release. Copying is not atomic, which is fine for
+/// fields of nodes that are only copied while they are not shared.
+template <typename T>
+class copyable_atomict
+{
+public:
+  copyable_atomict() = default;
+
+  // NOLINTNEXTLINE(runtime/explicit)
+  constexpr copyable_atomict(T _value) : value(_value)
+  {
+  }
+
+  copyable_atomict(const copyable_atomict &other)
+    : value(other.value.load(std::memory_order_relaxed))
+  {
+  }
+
+  copyable_atomict &operator=(const copyable_atomict &other)
+  {
+    value.store(
+      other.value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    return *this;
+  }
+
+  operator T() const
+  {
+    return value.load(std::memory_order_acquire);
+  }
+
+  copyable_atomict &operator=(T new_value)
+  {
+    value.store(new_value, std::memory_order_release);
+    return *this;
+  }
+
+  T operator++()
+  {
+    return value.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
+
+  T operator++(int)
+  {
+    return value.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  T operator--()
+  {
+    return value.fetch_sub(1, std::memory_order_acq_rel) - 1;
+  }
+
+  T operator--(int)
+  {
+    return value.fetch_sub(1, std::memory_order_acq_rel);
+  }
+
+  copyable_atomict &operator&=(T mask)
+  {
+    value.fetch_and(mask, std::memory_order_acq_rel);
+    return *this;
+  }
+
+  copyable_atomict &operator|=(T mask)
+  {
+    value.fetch_or(mask, std::memory_order_acq_rel);
+    return *this;
+  }
+
+private:
+  std::atomic<T> value;
+};
+
+/// Type of a field of a node that may be updated while the node is shared,
+/// e.g. a reference count. With ATOMIC_REF_COUNT, all updates are atomic, at
+/// some cost in single-threaded code; otherwise this is just \p T.
+template <typename T>
+using shared_fieldt = copyable_atomict<T>;
+
+#else
+
+template <typename T>
+using shared_fieldt = T;
+
+#endif
+
+#endif // CPROVER_UTIL_SHARED_FIELD_H
@@ -325,6 +325,21 @@ public:
     other.num=tmp;
   }
 
+  /// Check if two maps contain the same key-value pairs
+  ///
+  /// As the shape of the tree depends only on the keys it contains, the maps
+  /// are traversed in lockstep, and subtrees shared between them are skipped.
+  ///
+  /// Complexity:
+  /// - Worst case: O(N * log(S))
+  /// - Best case: O(1)
+  bool operator==(const sharing_mapt &other) const;
+
+  bool operator!=(const sharing_mapt &other) const
+  {
+    return !(*this == other);
+  }
+
   /// Get number of elements in map
   ///
   /// Complexity: O(1)
@@ -548,6 +563,17 @@ protected:
     const key_type &k,
     valueU &&m);
 
+  /// Replace the chain of nodes below \p ancestor that leads to \p inner by
+  /// the single leaf in the subtree of \p inner, if there is only one. This
+  /// method is called by `erase()` to keep the tree canonical, i.e., to make
+  /// the shape of the tree depend only on the keys it contains and not on the
+  /// order of insertions and erasures.
+  ///
+  /// \param inner: inner node whose subtree may contain a single leaf
+  /// \param ancestor: inner node above \p inner
+  /// \param bit: `ancestor[bit]` is the first node on the path to \p inner
+  void lift_single_leaf(nodet &inner, nodet &ancestor, const std::size_t bit);
+
   void iterate(
     const nodet &n,
     std::function<void(const key_type &k, const mapped_type &m)> f) const;
@@ -1062,6 +1088,88 @@ SHARING_MAPT(void)
   while(!stack.empty());
 }
 
+SHARING_MAPT(bool)::operator==(const sharing_mapt &other) const
+{
+  if(num != other.num)
+    return false;
+
+  if(empty() || map.shares_with(other.map))
+    return true;
+
+  typedef std::pair<const nodet *, const nodet *> stack_itemt;
+  std::stack<stack_itemt> stack;
+  stack.push({&map, &other.map});
+
+  do
+  {
+    const nodet &n1 = *stack.top().first;
+    const nodet &n2 = *stack.top().second;
+    stack.pop();
+
+    if(n1.shares_with(n2))
+      continue;
+
+    if(n1.is_internal())
+    {
+      if(!n2.is_internal())
+        return false;
+
+      const to_mapt &m1 = n1.get_to_map();
+      const to_mapt &m2 = n2.get_to_map();
+
+      if(m1.size() != m2.size())
+        return false;
+
+      for(const auto &item : m1)
+      {
+        const nodet *child = n2.find_child(item.first);
+        if(child == nullptr)
+          return false;
+
+        stack.push({&item.second, child});
+      }
+    }
+    else if(n1.is_leaf())
+    {
+      if(
+        !n2.is_leaf() || !equalT()(n1.get_key(), n2.get_key()) ||
+        !(n1.get_value() == n2.get_value()))
+      {
+        return false;
+      }
+    }
+    else
+    {
+      SM_ASSERT(n1.is_container());
+
+      if(!n2.is_container())
+        return false;
+
+      const leaf_listt &l1 = n1.get_container();
+      const leaf_listt &l2 = n2.get_container();
+
+      if(std::distance(l1.begin(), l1.end()) !=
+         std::distance(l2.begin(), l2.end()))
+      {
+        return false;
+      }
+
+      for(const auto &leaf : l1)
+      {
+        const nodet *other_leaf = n2.find_leaf(leaf.get_key());
+        if(
+          other_leaf == nullptr ||
+          !(leaf.get_value() == other_leaf->get_value()))
+        {
+          return false;
+        }
+      }
+    }
+  } while(!stack.empty());
+
+  return true;
+}
+
 SHARING_MAPT2(, nodet &)::get_leaf_node(const key_type &k)
 {
   SM_ASSERT(has_key(k));
@@ -1138,11 +1246,16 @@ SHARING_MAPT(void)::erase(const key_type &k)
 {
   SM_ASSERT(has_key(k));
 
+  // deepest node on the path with more than one child (or the root) and the
+  // one before it, which is where a lone remaining leaf is lifted to
   nodet *del = nullptr;
   std::size_t del_bit = 0;
+  nodet *above = nullptr;
+  std::size_t above_bit = 0;
 
   std::size_t key = hash()(k);
   nodet *ip = &map;
+  nodet *parent = nullptr;
 
   while(true)
   {
@@ -1152,10 +1265,13 @@ SHARING_MAPT(void)::erase(const key_type &k)
 
     if(m.size() > 1 || del == nullptr)
     {
+      above = del;
+      above_bit = del_bit;
       del = ip;
       del_bit=bit;
     }
 
+    parent = ip;
     ip = &ip->add_child(bit);
 
     PRECONDITION(!ip->empty());
@@ -1170,6 +1286,9 @@ SHARING_MAPT(void)::erase(const key_type &k)
       PRECONDITION(equalT()(ip->get_key(), k));
       del->remove_child(del_bit);
 
+      if(above != nullptr)
+        lift_single_leaf(*del, *above, above_bit);
+
       num--;
 
       return;
@@ -1185,10 +1304,27 @@ SHARING_MAPT(void)::erase(const key_type &k)
       {
         PRECONDITION(equalT()(ll.front().get_key(), k));
         del->remove_child(del_bit);
+
+        if(above != nullptr)
+          lift_single_leaf(*del, *above, above_bit);
       }
       else
       {
         ip->remove_leaf(k);
+
+        // the container is the only element of the subtree below del
+        if(del != parent)
+        {
+          const leaf_listt &rest = as_const_ptr(ip)->get_container();
+          if(std::next(rest.begin()) == rest.end())
+          {
+            nodet leaf(rest.front());
+            nodet &slot = del->add_child(del_bit);
+            nodet chain;
+            chain.swap(slot);
+            slot.swap(leaf);
+          }
+        }
       }
 
       num--;
@@ -1200,6 +1336,42 @@ SHARING_MAPT(void)::erase(const key_type &k)
   UNREACHABLE;
 }
 
+SHARING_MAPT(void)
+::lift_single_leaf(nodet &inner, nodet &ancestor, const std::size_t bit)
+{
+  SM_ASSERT(inner.is_defined_internal());
+
+  const to_mapt &m = as_const_ptr(&inner)->get_to_map();
+
+  if(m.size() != 1)
+    return;
+
+  const nodet &child = (*m.begin()).second;
+  const nodet *leaf = nullptr;
+
+  if(child.is_leaf())
+  {
+    leaf = &child;
+  }
+  else if(child.is_container())
+  {
+    const leaf_listt &ll = child.get_container();
+    if(std::next(ll.begin()) == ll.end())
+      leaf = &ll.front();
+  }
+
+  if(leaf == nullptr)
+    return;
+
+  // the copy shares the key and value with the leaf, and keeps it alive while
+  // the chain of nodes leading to it is replaced
+  nodet lifted(*leaf);
+  nodet &slot = ancestor.add_child(bit);
+  nodet chain;
+  chain.swap(slot);
+  slot.swap(lifted);
+}
+
 SHARING_MAPT4(valueU, void)
 ::migrate(
   const std::size_t starting_level,
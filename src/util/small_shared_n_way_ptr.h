@@ -15,6 +15,7 @@ Author: Daniel Poetzl
 #include <utility>
 
 #include "invariant.h"
+#include "shared_field.h"
 
 /// Get the type with the given index in the parameter pack
 template <std::size_t I, typename... Ts>
@@ -245,9 +246,9 @@ private:
       return;
     }
 
-    if(p->get_use_count() > 1)
+    // decrement and test in one step, as other threads may hold references
+    if(p->decrement_use_count() != 0)
     {
-      p->decrement_use_count();
       return;
     }
 
@@ -343,11 +344,12 @@ public:
     ++use_count;
   }
 
-  void decrement_use_count()
+  /// \return the use count after decrementing it
+  Num decrement_use_count()
   {
     PRECONDITION(get_use_count() > 0);
 
-    --use_count;
+    return --use_count & use_count_mask;
   }
 
   template <std::size_t I>
@@ -373,7 +375,10 @@ public:
   }
 
 private:
-  Num use_count = 0;
+  /// Use count in the low bits, type index in the high bits. If
+  /// ATOMIC_REF_COUNT is set, this is atomic, so that objects can be shared
+  /// between threads.
+  shared_fieldt<Num> use_count = 0;
 
   static const int bit_width = std::numeric_limits<Num>::digits;
 
@@ -18,6 +18,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "make_unique.h"
 #include "xml.h"
 #include "xml_irep.h"
+#include "xml_stream.h"
 
 ui_message_handlert::ui_message_handlert(
   message_handlert *_message_handler,
@@ -30,7 +31,8 @@ ui_message_handlert::ui_message_handlert(
     always_flush(always_flush),
     time(timestampert::make(clock_type)),
     out(std::cout),
-    json_stream(nullptr)
+    json_stream(nullptr),
+    xml_stream(nullptr)
 {
   switch(_ui)
   {
@@ -50,6 +52,8 @@ ui_message_handlert::ui_message_handlert(
 
       out << program_xml;
     }
+
+    xml_stream = util_make_unique<xml_streamt>(out);
     break;
 
   case uit::JSON_UI:
@@ -100,7 +104,8 @@ ui_message_handlert::~ui_message_handlert()
   switch(get_ui())
   {
   case uit::XML_UI:
-
+    INVARIANT(xml_stream, "XML stream must be initialized before use");
+    xml_stream->close();
     out << "</cprover>"
         << "\n";
     break;
@@ -171,7 +176,8 @@ void ui_message_handlert::print(
       INVARIANT(false, "Cannot print xml data on PLAIN UI");
       break;
     case uit::XML_UI:
-      out << data << '\n';
+      INVARIANT(xml_stream, "XML stream must be initialized before use");
+      xml_stream->push_back(data);
       flush(level);
       break;
     case uit::JSON_UI:
@@ -275,8 +281,8 @@ void ui_message_handlert::xml_ui_msg(
   if(!timestamp.empty())
     result.set_attribute("timestamp", timestamp);
 
-  out << result;
-  out << '\n';
+  INVARIANT(xml_stream, "XML stream must be initialized before use");
+  xml_stream->push_back(result);
 }
 
 void ui_message_handlert::json_ui_msg(
@@ -15,6 +15,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "cout_message.h"
 #include "json_stream.h"
 #include "timestamper.h"
+#include "xml_stream.h"
 
 class ui_message_handlert : public message_handlert
 {
@@ -40,6 +41,13 @@ public:
     PRECONDITION(json_stream!=nullptr);
     return *json_stream;
   }
+
+  virtual xml_streamt &get_xml_stream()
+  {
+    PRECONDITION(xml_stream != nullptr);
+    return *xml_stream;
+  }
+
   void print(unsigned level, const structured_datat &data) override;
 
 protected:
@@ -50,6 +58,7 @@ protected:
   std::unique_ptr<const timestampert> time;
   std::ostream &out;
   std::unique_ptr<json_stream_arrayt> json_stream;
+  std::unique_ptr<xml_streamt> xml_stream;
 
   ui_message_handlert(
     message_handlert *,
@@ -0,0 +1,116 @@
+/*******************************************************************\
+
+Module: Streaming XML output
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Streaming XML output
+
+#include "xml_stream.h"
+
+#include <ostream>
+
+xml_streamt::xml_streamt(
+  std::ostream &_out,
+  const std::string &name,
+  unsigned _indent)
+  : open(true),
+    out(_out),
+    indent(_indent),
+    top_level(false),
+    start_tag(name),
+    start_tag_output(false)
+{
+  // 'name' needs to be set, or we produce mal-formed XML
+  PRECONDITION(!name.empty());
+}
+
+xml_streamt::xml_streamt(std::ostream &_out)
+  : open(true), out(_out), indent(0), top_level(true), start_tag_output(true)
+{
+}
+
+void xml_streamt::output_start_tag()
+{
+  if(start_tag_output)
+    return;
+
+  out << std::string(indent, ' ') << '<' << start_tag.name;
+
+  for(const auto &attribute : start_tag.attributes)
+  {
+    // as in xmlt::output, attributes without name are dropped
+    if(attribute.first.empty())
+      continue;
+    out << ' ' << attribute.first << '=' << '"';
+    xmlt::escape_attribute(attribute.second, out);
+    out << '"';
+  }
+
+  out << '>' << '\n';
+
+  start_tag.attributes.clear();
+  start_tag_output = true;
+}
+
+void xml_streamt::output_child_separator()
+{
+  if(top_level)
+    out << '\n';
+}
+
+void xml_streamt::close_child_stream()
+{
+  if(child_stream)
+  {
+    child_stream->close();
+    child_stream = nullptr;
+    output_child_separator();
+  }
+}
+
+void xml_streamt::push_back(const xmlt &xml)
+{
+  PRECONDITION(open);
+  // To ensure consistency of the output, we output the start tag and close
+  // the current child stream before printing the given element.
+  output_start_tag();
+  close_child_stream();
+  xml.output(out, child_indent());
+  output_child_separator();
+}
+
+xml_streamt &xml_streamt::push_back_stream(const std::string &name)
+{
+  PRECONDITION(open);
+  output_start_tag();
+  close_child_stream();
+  child_stream =
+    std::unique_ptr<xml_streamt>(new xml_streamt(out, name, child_indent()));
+  return *child_stream;
+}
+
+void xml_streamt::close()
+{
+  if(!open)
+    return;
+
+  close_child_stream();
+  open = false;
+
+  if(top_level)
+    return;
+
+  if(!start_tag_output)
+  {
+    // no children: output an empty-element tag, as xmlt::output does
+    start_tag.output(out, indent);
+    return;
+  }
+
+  out << std::string(indent, ' ') << '<' << '/' << start_tag.name << '>'
+      << '\n';
+}
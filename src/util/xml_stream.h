@@ -0,0 +1,124 @@
+/*******************************************************************\
+
+Module: Streaming XML output
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Streaming XML output
+
+#ifndef CPROVER_UTIL_XML_STREAM_H
+#define CPROVER_UTIL_XML_STREAM_H
+
+#include <iosfwd>
+#include <memory>
+
+#include "invariant.h"
+#include "xml.h"
+
+/// This class provides a facility for streaming XML elements directly to the
+/// output instead of waiting for the element to be fully formed in memory
+/// and then printing it (as done using `xmlt`). This is the XML counterpart
+/// of `json_streamt` and bounds the memory needed to output e.g. long traces
+/// by the nesting depth of the output rather than by its size.
+///
+/// An `xml_streamt` stands for one element. Its attributes are collected
+/// until the first child is output or the stream is closed, at which point
+/// the start tag is printed. Children are either non-streaming `xmlt`
+/// elements, which are printed as a whole, or child streams. To ensure
+/// consistency of the output, a class invariant is that there is at most one
+/// child stream at any time: the existing child stream is closed when adding
+/// another child. The output is identical to that of `xmlt::output` on the
+/// equivalent tree.
+class xml_streamt
+{
+public:
+  /// Start streaming an element
+  /// \param out: output stream
+  /// \param name: name of the element
+  /// \param indent: indentation of the element, in spaces
+  xml_streamt(std::ostream &out, const std::string &name, unsigned indent = 0);
+
+  /// Stream the top-level elements of a document whose enclosing tags are
+  /// output by the caller. Each element is printed without indentation and
+  /// followed by an empty line, as done by `ui_message_handlert`.
+  explicit xml_streamt(std::ostream &out);
+
+  xml_streamt(const xml_streamt &) = delete;
+  xml_streamt &operator=(const xml_streamt &) = delete;
+
+  /// Closes the stream on destruction
+  ~xml_streamt()
+  {
+    close();
+  }
+
+  /// Set an attribute of the element; only possible before any child has
+  /// been output
+  void set_attribute(const std::string &attribute, const std::string &value)
+  {
+    PRECONDITION(open && !start_tag_output);
+    start_tag.set_attribute(attribute, value);
+  }
+
+  void set_attribute(const std::string &attribute, unsigned long long value)
+  {
+    PRECONDITION(open && !start_tag_output);
+    start_tag.set_attribute(attribute, value);
+  }
+
+  void set_attribute_bool(const std::string &attribute, bool value)
+  {
+    PRECONDITION(open && !start_tag_output);
+    start_tag.set_attribute_bool(attribute, value);
+  }
+
+  /// Output a non-streaming XML element as the next child of this element
+  /// \param xml: the element to output
+  void push_back(const xmlt &xml);
+
+  /// Add a child stream, closing the current one
+  /// \param name: name of the child element
+  /// \return the new child stream, which is valid until the next child is
+  ///   added or this stream is closed
+  xml_streamt &push_back_stream(const std::string &name);
+
+  /// Output the current child stream and the end tag, and close this stream
+  void close();
+
+protected:
+  /// Denotes whether the current stream is open or has been closed
+  bool open;
+  std::ostream &out;
+  unsigned indent;
+
+  /// Whether this stream only holds top-level elements and has no tags of
+  /// its own
+  const bool top_level;
+
+  /// Name and attributes of the element, until the start tag is output
+  xmlt start_tag;
+  bool start_tag_output;
+
+  /// The current child stream, if any
+  std::unique_ptr<xml_streamt> child_stream;
+
+  /// Output the start tag, unless done already
+  void output_start_tag();
+
+  /// Close and release the current child stream, if any
+  void close_child_stream();
+
+  /// Output the separator that follows a child element
+  void output_child_separator();
+
+  /// Indentation of the children of this element
+  unsigned child_indent() const
+  {
+    return top_level ? 0 : indent + 2;
+  }
+};
+
+#endif // CPROVER_UTIL_XML_STREAM_H
@@ -253,4 +253,56 @@ TEST_CASE("arbitrary precision integers", "[core][big-int][bigint]")
     N += 2; // 2
     REQUIRE(N.floorPow2() == 1);
   }
+
+  // =====================================================================
+  // Numbers stored without allocating, and native arithmetic on them.
+  // =====================================================================
+  SECTION("small numbers")
+  {
+    const BigInt::ullong_t max = ~BigInt::ullong_t(0);
+
+    BigInt a(max);
+    a += 1;
+    REQUIRE(to_string(a) == "18446744073709551616");
+    a -= 1;
+    REQUIRE(a == max);
+
+    BigInt b(5);
+    b -= 7;
+    REQUIRE(to_string(b) == "-2");
+    b += BigInt(-3);
+    REQUIRE(to_string(b) == "-5");
+    b -= BigInt(-5);
+    REQUIRE(b.is_zero());
+    REQUIRE(b.is_positive());
+
+    // products of elementary integers fit inline
+    BigInt c(max);
+    c *= max;
+    REQUIRE(to_string(c) == "340282366920938463426481119284349108225");
+    c *= c;
+    REQUIRE(
+      to_string(c) ==
+      "115792089237316195398462578067141184799968521174335529155754622898352762"
+      "650625");
+
+    // copies, moves and swaps between inline and allocated digits
+    BigInt d(c);
+    BigInt e(42);
+    REQUIRE(d == c);
+    d.swap(e);
+    REQUIRE(d == 42);
+    REQUIRE(e == c);
+    BigInt f(std::move(e));
+    REQUIRE(f == c);
+    e = d;
+    REQUIRE(e == 42);
+    d = f;
+    REQUIRE(d == c);
+    f = BigInt(7);
+    REQUIRE(f == 7);
+    f.swap(e);
+    REQUIRE(f == 42);
+    REQUIRE(e == 7);
+  }
 }
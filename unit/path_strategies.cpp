@@ -95,6 +95,12 @@ SCENARIO("path strategies")
        symex_eventt::resume(symex_eventt::enumt::NEXT, 5),
        symex_eventt::resume(symex_eventt::enumt::JUMP, 7),
        symex_eventt::result(symex_eventt::enumt::SUCCESS)});
+    check_with_strategy(
+      "distance",
+      opts_callback,
+      c,
+      {// No path can reach an assertion, so all are dropped
+       symex_eventt::result(symex_eventt::enumt::SUCCESS)});
   }
 
   GIVEN("a program with nested conditionals")
@@ -156,6 +162,13 @@ SCENARIO("path strategies")
        symex_eventt::resume(symex_eventt::enumt::NEXT, 14),
        symex_eventt::resume(symex_eventt::enumt::JUMP, 16),
        symex_eventt::result(symex_eventt::enumt::SUCCESS)});
+
+    check_with_strategy(
+      "distance",
+      opts_callback,
+      c,
+      {// No path can reach an assertion, so all are dropped
+       symex_eventt::result(symex_eventt::enumt::SUCCESS)});
   }
 
   GIVEN("a loop program to test functional correctness")
@@ -245,6 +258,75 @@ SCENARIO("path strategies")
         // Overall we fail.
         symex_eventt::result(symex_eventt::enumt::FAILURE),
       });
+
+    check_with_strategy(
+      "distance",
+      opts_callback,
+      c,
+      {
+        // Entry state is line 0
+        symex_eventt::resume(symex_eventt::enumt::NEXT, 0),
+
+        // The path where x != 1 cannot reach the assertion and is dropped.
+        symex_eventt::resume(symex_eventt::enumt::NEXT, 6),
+
+        // Leaving the loop is closer to the assertion than entering its body.
+        symex_eventt::resume(symex_eventt::enumt::JUMP, 9),
+        symex_eventt::result(symex_eventt::enumt::SUCCESS),
+
+        // Enter the loop body once and leave it again, the assertion fails.
+        symex_eventt::resume(symex_eventt::enumt::NEXT, 7),
+        symex_eventt::resume(symex_eventt::enumt::JUMP, 9),
+        symex_eventt::result(symex_eventt::enumt::FAILURE),
+
+        // The path entering the loop body twice is dropped, as the only
+        // assertion has been decided.
+
+        // Overall we fail.
+        symex_eventt::result(symex_eventt::enumt::FAILURE),
+      });
+  }
+
+  GIVEN("a program with assertions at different distances")
+  {
+    std::function<void(optionst &)> opts_callback = [](optionst &) {};
+
+    c =
+      "/*  1 */  int main()         \n"
+      "/*  2 */  {                  \n"
+      "/*  3 */    int x, y;        \n"
+      "/*  4 */    if(x)            \n"
+      "/*  5 */      assert(0);     \n"
+      "/*  6 */    else             \n"
+      "/*  7 */      y = 1;         \n"
+      "/*  8 */    assert(x == 0);  \n"
+      "/*  9 */  }                  \n";
+
+    check_with_strategy(
+      "lifo",
+      opts_callback,
+      c,
+      {// Entry state is line 0
+       symex_eventt::resume(symex_eventt::enumt::NEXT, 0),
+       symex_eventt::resume(symex_eventt::enumt::JUMP, 7),
+       symex_eventt::result(symex_eventt::enumt::SUCCESS),
+       symex_eventt::resume(symex_eventt::enumt::NEXT, 5),
+       symex_eventt::result(symex_eventt::enumt::FAILURE),
+       // Overall result
+       symex_eventt::result(symex_eventt::enumt::FAILURE)});
+
+    check_with_strategy(
+      "distance",
+      opts_callback,
+      c,
+      {// Entry state is line 0
+       symex_eventt::resume(symex_eventt::enumt::NEXT, 0),
+       // The assertion on line 5 is closest; both assertions fail on this
+       // path, after which the path through line 7 is dropped
+       symex_eventt::resume(symex_eventt::enumt::NEXT, 5),
+       symex_eventt::result(symex_eventt::enumt::FAILURE),
+       // Overall result
+       symex_eventt::result(symex_eventt::enumt::FAILURE)});
   }
 
   GIVEN("program to check for stop-on-fail with path exploration")
@@ -278,6 +360,19 @@ SCENARIO("path strategies")
          symex_eventt::result(symex_eventt::enumt::FAILURE),
          // Overall result
          symex_eventt::result(symex_eventt::enumt::FAILURE)});
+      check_with_strategy(
+        "distance",
+        no_halt_callback,
+        c,
+        {// Entry state is line 0
+         symex_eventt::resume(symex_eventt::enumt::NEXT, 0),
+         // Both assertions are equally close, so the path saved last wins
+         symex_eventt::resume(symex_eventt::enumt::JUMP, 7),
+         symex_eventt::result(symex_eventt::enumt::FAILURE),
+         symex_eventt::resume(symex_eventt::enumt::NEXT, 5),
+         symex_eventt::result(symex_eventt::enumt::FAILURE),
+         // Overall result
+         symex_eventt::result(symex_eventt::enumt::FAILURE)});
     }
     GIVEN("stopping on failure")
     {
@@ -421,6 +516,8 @@ void _check_with_strategy(
       goto_symext::get_goto_function(goto_model), symex_symbol_table);
   }
 
+  update_path_targets(*worklist, goto_model, properties, options);
+
   std::size_t expected_results_cnt = 0;
   while(!worklist->empty())
   {
@@ -472,6 +569,7 @@ void _check_with_strategy(
     }
 
     worklist->pop();
+    update_path_targets(*worklist, goto_model, properties, options);
 
     if(
       result.progress ==
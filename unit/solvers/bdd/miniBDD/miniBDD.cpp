@@ -350,4 +350,67 @@ SCENARIO("miniBDD", "[core][solver][miniBDD]")
       REQUIRE(oss.str() == "¬a ∨ b");
     }
   }
+
+  GIVEN("A bdd for (x1&y1)|(x2&y2)|(x3&y3) with a bad variable order")
+  {
+    mini_bdd_mgrt mgr;
+    mgr.auto_reorder = false;
+
+    std::vector<mini_bddt> x, y;
+    for(const std::string i : {"1", "2", "3"})
+      x.push_back(mgr.Var("x" + i));
+    for(const std::string i : {"1", "2", "3"})
+      y.push_back(mgr.Var("y" + i));
+
+    const auto build = [&]() {
+      return (x[0] & y[0]) | (x[1] & y[1]) | (x[2] & y[2]);
+    };
+
+    const mini_bddt bdd = build();
+    mgr.clear_computed_table();
+    const std::size_t nodes_before = mgr.number_of_nodes();
+    const unsigned x2_id = mgr.var_at_level(x[1].var());
+
+    WHEN("The variables are reordered")
+    {
+      mgr.reorder();
+
+      THEN("The number of nodes decreases")
+      {
+        REQUIRE(mgr.number_of_nodes() < nodes_before);
+      }
+      THEN("Building the same function yields the same node")
+      {
+        REQUIRE(build().node_number() == bdd.node_number());
+      }
+      THEN("Variables keep their labels and identifiers")
+      {
+        for(std::size_t i = 0; i < 3; ++i)
+        {
+          REQUIRE(
+            mgr.var_table[x[i].var() - 1].label == "x" + std::to_string(i + 1));
+          REQUIRE(mgr.var_at_level(x[i].var()) == i + 1);
+          REQUIRE(
+            mgr.var_table[y[i].var() - 1].label == "y" + std::to_string(i + 1));
+          REQUIRE(mgr.var_at_level(y[i].var()) == i + 4);
+        }
+      }
+      THEN("Quantifying a variable uses its identifier, not its old level")
+      {
+        REQUIRE(mgr.level_of_var(x2_id) == x[1].var());
+        REQUIRE(x[1].var() != x2_id);
+        const mini_bddt rest = (x[0] & y[0]) | (x[2] & y[2]);
+        REQUIRE(
+          restrict(bdd, x2_id, true).node_number() ==
+          (y[1] | rest).node_number());
+        REQUIRE(
+          restrict(bdd, x2_id, false).node_number() == rest.node_number());
+        REQUIRE(
+          exists(bdd, x2_id).node_number() == (y[1] | rest).node_number());
+        REQUIRE(
+          substitute(bdd, x2_id, y[0]).node_number() ==
+          ((y[0] & y[1]) | rest).node_number());
+      }
+    }
+  }
 }
@@ -218,3 +218,64 @@ SCENARIO("float_approximation", "[core][solvers][floatbv][float_approximation]")
     }
   }
 }
+
+SCENARIO("float_utils_cache", "[core][solvers][floatbv][float_utils]")
+{
+  satcheckt satcheck(null_message_handler);
+  float_utils_cachet cache;
+
+  float_utilst float_utils(satcheck);
+  float_utils.spec = ieee_float_spect::single_precision();
+  float_utils.set_cache(cache);
+
+  const bvt op1 = satcheck.new_variables(float_utils.spec.width());
+  const bvt op2 = satcheck.new_variables(float_utils.spec.width());
+
+  GIVEN("An operation that has already been encoded")
+  {
+    const bvt sum = float_utils.add(op1, op2);
+    const std::size_t variables = satcheck.no_variables();
+
+    THEN("Encoding it again re-uses the circuit")
+    {
+      float_utilst other(satcheck);
+      other.spec = float_utils.spec;
+      other.set_cache(cache);
+
+      REQUIRE(other.add(op1, op2) == sum);
+      REQUIRE(satcheck.no_variables() == variables);
+    }
+
+    THEN("A different operation or rounding mode gets a new circuit")
+    {
+      REQUIRE(float_utils.sub(op1, op2) != sum);
+
+      float_utils.rounding_mode_bits.set(ieee_floatt::ROUND_TO_ZERO);
+      REQUIRE(float_utils.add(op1, op2) != sum);
+    }
+  }
+
+  GIVEN("Two constants")
+  {
+    ieee_floatt i1(ieee_float_spect::single_precision());
+    ieee_floatt i2(ieee_float_spect::single_precision());
+    i1.from_float(1.5f);
+    i2.from_float(-0.25f);
+    const bvt b1 = float_utils.build_constant(i1);
+    const bvt b2 = float_utils.build_constant(i2);
+
+    THEN("Cached results are correct")
+    {
+      const bvt first = float_utils.mul(b1, b2);
+      const bvt second = float_utils.mul(b1, b2);
+      REQUIRE(first == second);
+
+      REQUIRE(satcheck.prop_solve() == satcheckt::resultt::P_SATISFIABLE);
+
+      ieee_floatt expected(ieee_float_spect::single_precision());
+      expected.from_float(1.5f * -0.25f);
+      REQUIRE(float_utils.get(second) == expected);
+      REQUIRE(float_utils.is_finite(second).is_true());
+    }
+  }
+}
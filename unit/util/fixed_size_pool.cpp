@@ -0,0 +1,47 @@
+/*******************************************************************\
+
+Module: Unit tests for fixed_size_poolt
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+#include <util/fixed_size_pool.h>
+
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <vector>
+
+TEST_CASE("fixed_size_poolt", "[core][util][fixed_size_pool]")
+{
+  typedef fixed_size_poolt<24> poolt;
+
+  // more than fit into a single block
+  std::vector<void *> objects;
+  for(std::size_t i = 0; i < 10000; ++i)
+  {
+    void *p = poolt::allocate();
+    REQUIRE(p != nullptr);
+    const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(p);
+    REQUIRE(address % alignof(std::max_align_t) == 0);
+    std::memset(p, 0xff, 24);
+    objects.push_back(p);
+  }
+
+  const std::set<void *> distinct(objects.begin(), objects.end());
+  REQUIRE(distinct.size() == objects.size());
+
+  // freed objects are reused
+  void *last = objects.back();
+  objects.pop_back();
+  poolt::deallocate(last);
+  REQUIRE(poolt::allocate() == last);
+  objects.push_back(last);
+
+  for(void *p : objects)
+    poolt::deallocate(p);
+
+  poolt::deallocate(nullptr);
+}
@@ -0,0 +1,198 @@
+/*******************************************************************\
+
+Module: Unit tests for ieee_floatt
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+#include <util/arith_tools.h>
+#include <util/ieee_float.h>
+
+#include <cfenv>
+#include <cfloat>
+#include <limits>
+#include <random>
+
+static ieee_floatt
+make_double(double d, ieee_floatt::rounding_modet rounding_mode)
+{
+  ieee_floatt result;
+  result.from_double(d);
+  result.rounding_mode = rounding_mode;
+  return result;
+}
+
+TEST_CASE("ieee_floatt rounding modes", "[core][util][ieee_float]")
+{
+  // 1/3 is not representable; the results of rounding up and down are one
+  // unit in the last place apart
+  ieee_floatt down = make_double(1, ieee_floatt::ROUND_TO_ZERO);
+  down /= make_double(3, ieee_floatt::ROUND_TO_EVEN);
+  ieee_floatt up = make_double(1, ieee_floatt::ROUND_TO_PLUS_INF);
+  up /= make_double(3, ieee_floatt::ROUND_TO_EVEN);
+  ieee_floatt nearest = make_double(1, ieee_floatt::ROUND_TO_EVEN);
+  nearest /= make_double(3, ieee_floatt::ROUND_TO_EVEN);
+
+  REQUIRE(down < up);
+  REQUIRE(nearest == down);
+  down.increment();
+  REQUIRE(down == up);
+
+  // overflow yields infinity or the largest finite number
+  const double max = std::numeric_limits<double>::max();
+  ieee_floatt overflow = make_double(max, ieee_floatt::ROUND_TO_EVEN);
+  overflow *= make_double(2, ieee_floatt::ROUND_TO_EVEN);
+  REQUIRE(overflow.is_infinity());
+  overflow = make_double(max, ieee_floatt::ROUND_TO_ZERO);
+  overflow *= make_double(2, ieee_floatt::ROUND_TO_EVEN);
+  REQUIRE(overflow.to_double() == max);
+
+  // the sign of an exact zero sum depends on the rounding mode
+  ieee_floatt zero = make_double(1, ieee_floatt::ROUND_TO_MINUS_INF);
+  zero -= make_double(1, ieee_floatt::ROUND_TO_EVEN);
+  REQUIRE(zero.is_zero());
+  REQUIRE(zero.get_sign());
+  zero = make_double(1, ieee_floatt::ROUND_TO_EVEN);
+  zero -= make_double(1, ieee_floatt::ROUND_TO_EVEN);
+  REQUIRE(zero.is_zero());
+  REQUIRE(!zero.get_sign());
+
+  // subnormal results
+  const double min = std::numeric_limits<double>::min();
+  ieee_floatt subnormal = make_double(min, ieee_floatt::ROUND_TO_EVEN);
+  subnormal /= make_double(4, ieee_floatt::ROUND_TO_EVEN);
+  REQUIRE(subnormal.to_double() == min / 4);
+  REQUIRE(!subnormal.is_normal());
+}
+
+TEST_CASE("ieee_floatt special values", "[core][util][ieee_float]")
+{
+  ieee_floatt nan = make_double(0, ieee_floatt::ROUND_TO_EVEN);
+  nan /= make_double(0, ieee_floatt::ROUND_TO_EVEN);
+  REQUIRE(nan.is_NaN());
+
+  ieee_floatt inf = make_double(1, ieee_floatt::ROUND_TO_EVEN);
+  inf /= make_double(-0.0, ieee_floatt::ROUND_TO_EVEN);
+  REQUIRE(inf.is_infinity());
+  REQUIRE(inf.get_sign());
+
+  inf += make_double(1, ieee_floatt::ROUND_TO_EVEN);
+  REQUIRE(inf.is_infinity());
+}
+
+TEST_CASE("ieee_floatt other formats", "[core][util][ieee_float]")
+{
+  // half precision is not implemented by the host and uses the software
+  // implementation
+  ieee_floatt a(ieee_float_spect::half_precision());
+  a.from_integer(1);
+  ieee_floatt b(ieee_float_spect::half_precision());
+  b.from_integer(3);
+
+  a /= b;
+  a *= b;
+  REQUIRE(a == 1);
+
+  a += b;
+  REQUIRE(a.to_integer() == 4);
+}
+
+/// Gives access to the host FPU and the software implementation of the
+/// operators separately
+class ieee_float_testt : public ieee_floatt
+{
+public:
+  explicit ieee_float_testt(const ieee_floatt &value) : ieee_floatt(value)
+  {
+  }
+
+  using ieee_floatt::native_operation;
+  using ieee_floatt::native_operationt;
+  using ieee_floatt::add;
+  using ieee_floatt::multiply;
+  using ieee_floatt::divide;
+};
+
+/// Apply \p operation to \p lhs and \p rhs both natively and in software
+/// \return false if the host FPU can't be used for these operands, or
+///   whether the two results agree otherwise
+static bool native_agrees_with_software(
+  const ieee_floatt &lhs,
+  const ieee_floatt &rhs,
+  ieee_float_testt::native_operationt operation)
+{
+  ieee_float_testt native(lhs);
+  if(!native.native_operation(rhs, operation))
+    return false;
+
+  ieee_float_testt software(lhs);
+  switch(operation)
+  {
+  case ieee_float_testt::native_operationt::ADD:
+    software.add(rhs);
+    break;
+  case ieee_float_testt::native_operationt::MULTIPLY:
+    software.multiply(rhs);
+    break;
+  case ieee_float_testt::native_operationt::DIVIDE:
+    software.divide(rhs);
+    break;
+  }
+
+  INFO("lhs " << lhs.pack() << ", rhs " << rhs.pack());
+  INFO("native " << native.pack() << ", software " << software.pack());
+  REQUIRE(native.pack() == software.pack());
+  return true;
+}
+
+TEST_CASE("ieee_floatt host FPU", "[core][util][ieee_float]")
+{
+  // random bit patterns cover normal and subnormal numbers of all magnitudes,
+  // zeros, infinities and NaNs; as the exponents of such operands are mostly
+  // far apart, every other right-hand side is close to the left-hand side
+  std::mt19937_64 generator(0);
+  std::size_t native_operations = 0;
+
+  for(const auto &spec : {ieee_float_spect::single_precision(),
+                          ieee_float_spect::double_precision()})
+  {
+    const mp_integer values = power(2, spec.width());
+
+    for(const auto rounding_mode : {ieee_floatt::ROUND_TO_EVEN,
+                                    ieee_floatt::ROUND_TO_MINUS_INF,
+                                    ieee_floatt::ROUND_TO_PLUS_INF,
+                                    ieee_floatt::ROUND_TO_ZERO})
+    {
+      for(std::size_t i = 0; i < 2000; ++i)
+      {
+        ieee_floatt lhs(spec);
+        lhs.rounding_mode = rounding_mode;
+        lhs.unpack(mp_integer(generator()) % values);
+        ieee_floatt rhs(spec);
+        rhs.rounding_mode = rounding_mode;
+        if(i % 2 == 0)
+          rhs.unpack(mp_integer(generator()) % values);
+        else
+          rhs.unpack((lhs.pack() + generator() % 1024) % values);
+
+        for(const auto operation :
+            {ieee_float_testt::native_operationt::ADD,
+             ieee_float_testt::native_operationt::MULTIPLY,
+             ieee_float_testt::native_operationt::DIVIDE})
+        {
+          if(native_agrees_with_software(lhs, rhs, operation))
+            ++native_operations;
+        }
+      }
+    }
+  }
+
+  // as in ieee_float.cpp, the host FPU is only used if it does not evaluate
+  // in extended precision and supports all rounding modes
+#if FLT_EVAL_METHOD == 0 && defined(FE_TONEAREST) && defined(FE_DOWNWARD) && \
+  defined(FE_UPWARD) && defined(FE_TOWARDZERO)
+  REQUIRE(native_operations > 0);
+#endif
+}
@@ -7,6 +7,8 @@
 #include <util/irep.h>
 #include <util/std_expr.h>
 
+#include <thread>
+
 #ifdef SHARING
 
 SCENARIO("irept_sharing_trade_offs", "[core][utils][irept]" XFAIL)
@@ -221,4 +223,41 @@ SCENARIO("exprt_sharing", "[core][utils][exprt]")
   }
 }
 
+#if ATOMIC_REF_COUNT
+
+TEST_CASE("irept shared between threads", "[core][utils][irept]")
+{
+  exprt shared(ID_plus);
+  for(std::size_t i = 0; i < 8; ++i)
+    shared.add_to_operands(symbol_exprt(std::to_string(i), typet(ID_bool)));
+
+  // every thread copies, reads and modifies private copies of the shared
+  // tree, which changes the reference counts of its nodes concurrently
+  std::vector<std::thread> threads;
+  for(std::size_t t = 0; t < 4; ++t)
+  {
+    threads.emplace_back([&shared, t] {
+      for(std::size_t i = 0; i < 100000; ++i)
+      {
+        exprt copy = shared;
+        exprt operand = copy.operands()[i % 8];
+        copy.operands()[t].id(ID_0);
+        operand.id(ID_1);
+      }
+    });
+  }
+  for(auto &thread : threads)
+    thread.join();
+
+  REQUIRE(shared.operands().size() == 8);
+  for(const auto &operand : shared.operands())
+  {
+    REQUIRE(operand.id() == ID_symbol);
+    REQUIRE(operand.read().ref_count == 1);
+  }
+  REQUIRE(shared.read().ref_count == 1);
+}
+
+#endif
+
 #endif
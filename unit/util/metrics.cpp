@@ -0,0 +1,82 @@
+/*******************************************************************\
+
+Module: Unit tests for metricst
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+#include <util/json.h>
+#include <util/metrics.h>
+
+#include <sstream>
+
+TEST_CASE("metricst records nothing until enabled", "[core][util][metrics]")
+{
+  metricst metrics;
+  metrics.add("counter");
+  metrics.set("gauge", 3);
+  metrics.add_time(
+    "phase",
+    std::chrono::duration<double>(1),
+    std::chrono::duration<double>(1));
+
+  const json_objectt json = metrics.to_json();
+  REQUIRE(to_json_object(json["counters"]).size() == 0);
+  REQUIRE(to_json_object(json["gauges"]).size() == 0);
+  REQUIRE(to_json_object(json["phases"]).size() == 0);
+}
+
+TEST_CASE("metricst accumulates metrics", "[core][util][metrics]")
+{
+  metricst metrics;
+  metrics.enable();
+
+  metrics.add("counter");
+  metrics.add("counter", 2);
+  metrics.set("gauge", 5);
+  metrics.set("gauge", 4);
+  metrics.add_time(
+    "phase",
+    std::chrono::duration<double>(0.5),
+    std::chrono::duration<double>(0.25));
+  metrics.add_time(
+    "phase",
+    std::chrono::duration<double>(1.5),
+    std::chrono::duration<double>(0.25));
+
+  const json_objectt json = metrics.to_json();
+  REQUIRE(to_json_object(json["counters"])["counter"].value == "3");
+  REQUIRE(to_json_object(json["gauges"])["gauge"].value == "4");
+
+  const json_objectt &phase =
+    to_json_object(to_json_object(json["phases"])["phase"]);
+  REQUIRE(phase["count"].value == "2");
+  REQUIRE(std::stod(phase["wallTime"].value) == 2.0);
+  REQUIRE(std::stod(phase["cpuTime"].value) == 0.5);
+
+  REQUIRE(json["peakMemory"].is_number());
+
+  std::ostringstream out;
+  metrics.output_json(out);
+  REQUIRE(out.str().find("\"counter\": 3") != std::string::npos);
+}
+
+TEST_CASE("scoped_metrics_timert", "[core][util][metrics]")
+{
+  {
+    scoped_metrics_timert timer("disabled phase");
+  }
+
+  get_metrics().enable();
+  {
+    scoped_metrics_timert timer("enabled phase");
+  }
+
+  const json_objectt json = get_metrics().to_json();
+  const json_objectt &phases = to_json_object(json["phases"]);
+  REQUIRE(phases.find("disabled phase") == phases.end());
+  REQUIRE(phases.find("enabled phase") != phases.end());
+  REQUIRE(to_json_object(phases["enabled phase"])["count"].value == "1");
+}
@@ -9,9 +9,11 @@ Author: Daniel Poetzl
 #define SM_INTERNAL_CHECKS
 #define SN_INTERNAL_CHECKS
 
+#include <atomic>
 #include <climits>
 #include <random>
 #include <set>
+#include <thread>
 
 #include <testing-utils/use_catch.h>
 #include <util/sharing_map.h>
@@ -165,9 +167,10 @@ void sharing_map_internals_test()
       count = sm.count_unmarked_nodes(false, marked, false);
       REQUIRE(count == 4);
 
+      // the remaining leaf is lifted back to the root
       sm.erase(1 << chunk);
       count = sm.count_unmarked_nodes(false, marked, false);
-      REQUIRE(count == 3);
+      REQUIRE(count == 2);
     }
 
     SECTION("third node decisive")
@@ -182,7 +185,7 @@ void sharing_map_internals_test()
 
       sm.erase(1 << (2 * chunk));
       count = sm.count_unmarked_nodes(false, marked, false);
-      REQUIRE(count == 4);
+      REQUIRE(count == 2);
     }
 
     SECTION("last non-container node is decisive")
@@ -197,7 +200,7 @@ void sharing_map_internals_test()
 
       sm.erase(1 << (chunk * (levels - 1)));
       count = sm.count_unmarked_nodes(false, marked, false);
-      REQUIRE(count == levels + 1); // inner nodes + leafs
+      REQUIRE(count == 2);
     }
 
     SECTION("stored in container node")
@@ -211,17 +214,50 @@ void sharing_map_internals_test()
       count = sm.count_unmarked_nodes(false, marked, false);
       REQUIRE(count == levels + 1 + 2); // inner nodes + container + leafs
 
+      // the remaining leaf is lifted out of the container back to the root
       sm.erase(1 << (chunk * levels));
       count = sm.count_unmarked_nodes(false, marked, false);
-      REQUIRE(count == levels + 1 + 1); // inner nodes + container + leafs
+      REQUIRE(count == 2);
 
-      // existing leaf still in container, not migrating necessary
+      // existing leaf is migrated to the bottom again
       sm.insert(1 << (chunk * levels), "d");
       count = sm.count_unmarked_nodes(false, marked, false);
       REQUIRE(count == levels + 1 + 2); // inner nodes + container + leafs
     }
   }
 
+  SECTION("canonical shape")
+  {
+    std::set<const void *> marked;
+    std::mt19937 generator(0);
+    std::uniform_int_distribution<unsigned> distribution(0, 63);
+
+    sharing_map_unsignedt sm;
+
+    for(std::size_t i = 0; i < 1000; ++i)
+    {
+      // the two upper bits are not used by the hash, so keys that differ only
+      // in them end up in the same container
+      const unsigned k = distribution(generator);
+      const unsigned key = (k & 0x3) << 30 | (k >> 2) << (3 * (k & 0x3));
+
+      if(sm.has_key(key))
+        sm.erase(key);
+      else
+        sm.insert(key, "a");
+
+      sharing_map_unsignedt fresh;
+      sm.iterate([&fresh](const unsigned &k, const std::string &m) {
+        fresh.insert(k, m);
+      });
+
+      REQUIRE(sm == fresh);
+      REQUIRE(
+        sm.count_unmarked_nodes(false, marked, false) ==
+        fresh.count_unmarked_nodes(false, marked, false));
+    }
+  }
+
   SECTION("delta view (sharing, one of the maps is deeper)")
   {
     std::set<const void *> marked;
@@ -434,6 +470,70 @@ TEST_CASE("Sharing map copying", "[core][util]")
   REQUIRE(sm3.has_key("i"));
 }
 
+TEST_CASE("Sharing map equality", "[core][util]")
+{
+  sharing_map_standardt sm1;
+  sharing_map_standardt sm2;
+
+  REQUIRE(sm1 == sm2);
+
+  fill(sm1);
+  REQUIRE(sm1 != sm2);
+
+  // different order of insertions
+  sm2.insert("k", "2");
+  sm2.insert("i", "0");
+  sm2.insert("j", "1");
+  REQUIRE(sm1 == sm2);
+
+  sharing_map_standardt sm3(sm1);
+  REQUIRE(sm1 == sm3);
+
+  sm3.replace("j", "7");
+  REQUIRE(sm1 != sm3);
+
+  sm3.replace("j", "1");
+  REQUIRE(sm1 == sm3);
+
+  // same size, different keys
+  sm3.erase("j");
+  sm3.insert("x", "1");
+  REQUIRE(sm1 != sm3);
+
+  // erasing and reinserting yields the same shape
+  sm3.erase("x");
+  fill2(sm3);
+  sm3.erase("l");
+  sm3.erase("m");
+  sm3.erase("n");
+  sm3.insert("j", "1");
+  REQUIRE(sm1 == sm3);
+
+  SECTION("collisions")
+  {
+    sharing_mapt<std::size_t, std::string, false, key_hasht> sm4;
+    sharing_mapt<std::size_t, std::string, false, key_hasht> sm5;
+
+    sm4.insert(0, "a");
+    sm4.insert(8, "b");
+    sm4.insert(16, "c");
+
+    sm5.insert(16, "c");
+    sm5.insert(0, "a");
+    sm5.insert(8, "b");
+    REQUIRE(sm4 == sm5);
+
+    sm5.replace(8, "x");
+    REQUIRE(sm4 != sm5);
+
+    sm5.erase(8);
+    sm4.erase(8);
+    sm4.erase(16);
+    sm5.erase(16);
+    REQUIRE(sm4 == sm5);
+  }
+}
+
 TEST_CASE("Sharing map collisions", "[core][util]")
 {
   typedef sharing_mapt<std::size_t, std::string, false, key_hasht>
@@ -956,3 +1056,40 @@ TEST_CASE("Sharing map with a non-default-constructable value", "[core][util]")
   REQUIRE(!entry_2.is_in_both_maps());
   REQUIRE(entry_2.m.val == 2);
 }
+
+#if ATOMIC_REF_COUNT
+TEST_CASE("Sharing map shared between threads", "[core][util]")
+{
+  typedef sharing_mapt<unsigned, unsigned, false, unsigned_hasht> mapt;
+  mapt shared;
+  for(unsigned i = 0; i < 1000; ++i)
+    shared.insert(i, i);
+
+  // every thread reads the shared map and modifies private copies of it,
+  // which changes the use counts of shared nodes concurrently; Catch
+  // assertions are not thread-safe, so count the failures instead
+  std::atomic<std::size_t> failures(0);
+  std::vector<std::thread> threads;
+  for(unsigned t = 0; t < 4; ++t)
+  {
+    threads.emplace_back([&shared, &failures, t] {
+      for(unsigned i = 0; i < 10000; ++i)
+      {
+        mapt copy = shared;
+        const auto value = copy.find(i % 1000);
+        if(!value.has_value() || value->get() != i % 1000)
+          ++failures;
+        copy.replace(i % 1000, t);
+        copy.erase((i + 1) % 1000);
+      }
+    });
+  }
+  for(auto &thread : threads)
+    thread.join();
+
+  REQUIRE(failures == 0);
+  REQUIRE(shared.size() == 1000);
+  for(unsigned i = 0; i < 1000; ++i)
+    REQUIRE(shared.find(i).value().get() == i);
+}
+#endif
@@ -0,0 +1,90 @@
+/*******************************************************************\
+
+Module: Unit tests for xml_streamt
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+#include <util/xml_stream.h>
+
+#include <sstream>
+
+static std::string to_string(const xmlt &xml)
+{
+  std::ostringstream out;
+  xml.output(out);
+  return out.str();
+}
+
+TEST_CASE("xml_stream output", "[core][util][xml_stream]")
+{
+  std::ostringstream out;
+
+  SECTION("Empty element")
+  {
+    {
+      xml_streamt stream(out, "a");
+      stream.set_attribute("b", "c");
+    }
+    xmlt expected("a");
+    expected.set_attribute("b", "c");
+    REQUIRE(out.str() == to_string(expected));
+  }
+
+  SECTION("Nested elements")
+  {
+    xmlt leaf("leaf");
+    leaf.data = "x < y";
+    leaf.set_attribute("n", 1u);
+
+    xmlt expected("root");
+    expected.set_attribute("z", "\"quoted\"");
+    expected.set_attribute("a", "&");
+    expected.new_element(leaf);
+    xmlt &child = expected.new_element("child");
+    child.set_attribute_bool("flag", true);
+    child.new_element(leaf);
+    child.new_element(leaf);
+    expected.new_element("empty");
+    expected.new_element(leaf);
+
+    {
+      xml_streamt root(out, "root");
+      // attributes are output in the same order as by xmlt
+      root.set_attribute("z", "\"quoted\"");
+      root.set_attribute("a", "&");
+      root.push_back(leaf);
+      xml_streamt &child_stream = root.push_back_stream("child");
+      child_stream.set_attribute_bool("flag", true);
+      child_stream.push_back(leaf);
+      child_stream.push_back(leaf);
+      // adding another child closes child_stream
+      root.push_back_stream("empty");
+      root.push_back(leaf);
+    }
+
+    REQUIRE(out.str() == to_string(expected));
+  }
+
+  SECTION("Top-level elements")
+  {
+    xmlt leaf("leaf");
+    leaf.data = "1";
+
+    {
+      xml_streamt stream(out);
+      stream.push_back(leaf);
+      stream.push_back_stream("element").push_back(leaf);
+      stream.push_back(leaf);
+    }
+
+    REQUIRE(
+      out.str() == "<leaf>1</leaf>\n\n"
+                   "<element>\n"
+                   "  <leaf>1</leaf>\n"
+                   "</element>\n\n"
+                   "<leaf>1</leaf>\n\n");
+  }
+}